@@ -0,0 +1,160 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Cold start time of a catalog with sgp4_bulk_init.
+ *
+ * Reads a catalog of two or three line element sets and initialises it with 1, 2, 4, ...
+ * threads up to the number of online processors, printing the time of each run. The
+ * lines are read again before each run, since twoline2rv modifies them.
+ *
+ * Usage: sgp4_bulk_bench catalog.txt
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4_bulk_bench SGP4 Bulk Initialisation Benchmark
+ * \ingroup examples
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sgp4/sgp4bulk.h>
+
+/* Reads the element sets of a catalog, skipping name lines. Returns the number of records */
+static size_t load(const char *path, char ***line1, char ***line2)
+{
+    FILE *f = fopen(path, "r");
+    char buf[130], *prev = NULL;
+    size_t n = 0, cap = 0;
+
+    *line1 = NULL;
+    *line2 = NULL;
+    if (f == NULL)
+    {
+        return 0;
+    }
+
+    while (fgets(buf, sizeof(buf), f) != NULL)
+    {
+        buf[strcspn(buf, "\r\n")] = '\0';
+        if ((buf[0] == '1') && (buf[1] == ' '))
+        {
+            free(prev);
+            prev = strdup(buf);
+        }
+        else if ((buf[0] == '2') && (buf[1] == ' ') && (prev != NULL))
+        {
+            if (n == cap)
+            {
+                cap = cap ? 2 * cap : 1024;
+                *line1 = realloc(*line1, cap * sizeof(char *));
+                *line2 = realloc(*line2, cap * sizeof(char *));
+            }
+            (*line1)[n] = prev;
+            (*line2)[n] = strdup(buf);
+            prev = NULL;
+            n++;
+        }
+    }
+    free(prev);
+    fclose(f);
+
+    return n;
+}
+
+static void unload(char **line1, char **line2, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+    {
+        free(line1[i]);
+        free(line2[i]);
+    }
+    free(line1);
+    free(line2);
+}
+
+int main(int argc, char *argv[])
+{
+    char **line1, **line2;
+    elsetrec *satrecs;
+    int *status;
+    sgp4_bulkstats_t stats;
+    size_t n;
+    int nthreads, ncpu = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (argc < 2)
+    {
+        printf("Usage: %s catalog.txt\n", argv[0]);
+        return 1;
+    }
+
+    for(nthreads = 1; ; nthreads *= 2)
+    {
+        if (nthreads > ncpu)
+        {
+            nthreads = ncpu;
+        }
+
+        n = load(argv[1], &line1, &line2);
+        if (n == 0)
+        {
+            printf("No element sets in %s\n", argv[1]);
+            return 1;
+        }
+
+        satrecs = calloc(n, sizeof(elsetrec));
+        status  = calloc(n, sizeof(int));
+
+        sgp4_bulk_init(wgs72, 'i', line1, line2, n, nthreads, satrecs, status, &stats);
+
+        printf("%2d threads: %zu records (%zu deep space), %zu failed, %.1f ms, %.2f us/record\n",
+               stats.nthreads, n, stats.ndeep, stats.nfail, stats.seconds * 1e3, stats.seconds * 1e6 / n);
+
+        free(satrecs);
+        free(status);
+        unload(line1, line2, n);
+
+        if (nthreads >= ncpu)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/** \} End of sgp4_bulk_bench group */
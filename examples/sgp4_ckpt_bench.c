@@ -0,0 +1,146 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Benchmark of the checkpointed resonance integrator.
+ *
+ * Random-access queries on a Molniya (irez 2) and a GEO (irez 1) orbit, at growing
+ * distances from epoch. Without checkpoints a query integrates from epoch or from the
+ * previous query; with a 720 minute checkpoint table the cost stays flat.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4_ckpt_bench SGP4 Checkpoint Benchmark
+ * \ingroup examples
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <sgp4/sgp4io.h>
+#include <sgp4/sgp4ckpt.h>
+
+#define QUERIES     2000
+#define DAY         1440.0
+
+static const char *tles[][3] =
+{
+    {"Molniya 09880", "1 09880U 77021A   06176.56157475  .00000421  00000-0  10000-3 0  9814",
+                      "2 09880  64.5968 349.3786 7069051 270.0229  16.3320  2.00813614112380"},
+    {"GEO 28626",     "1 28626U 05008A   06176.46683397 -.00000205  00000-0  10000-3 0  2190",
+                      "2 28626   0.0019 286.9433 0000335  13.7918  55.6504  1.00270176  4891"},
+};
+
+static const double distances[] = {1.0, 7.0, 30.0, 90.0, 180.0, 365.0};   /* days */
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/* Mean time per query (ns) at random times within one day of +/- distance */
+static double bench(const elsetrec *satrec, const sgp4_ckpt_t *ckpt, const double times[])
+{
+    sgp4_ctx_t ctx;
+    double r[3], v[3], start;
+    int i;
+
+    sgp4_ctx_init(&ctx);
+
+    start = now();
+    for(i = 0; i < QUERIES; i++)
+    {
+        if (ckpt != NULL)
+        {
+            sgp4_ckpt(wgs72, satrec, ckpt, &ctx, times[i], r, v);
+        }
+        else
+        {
+            sgp4_r(wgs72, satrec, &ctx, times[i], r, v);
+        }
+    }
+
+    return (now() - start) * 1e9 / QUERIES;
+}
+
+int main(void)
+{
+    char line1[130], line2[130];
+    double times[QUERIES], start, build;
+    elsetrec satrec;
+    sgp4_ckpt_t ckpt;
+    size_t s, d;
+    int i;
+
+    srand(1);
+
+    for(s = 0; s < sizeof(tles) / sizeof(tles[0]); s++)
+    {
+        strcpy(line1, tles[s][1]);
+        strcpy(line2, tles[s][2]);
+        twoline2rv(line1, line2, 'i', wgs72, &satrec);
+
+        start = now();
+        sgp4_ckpt_build(wgs72, &satrec, -366.0 * DAY, 366.0 * DAY, 720.0, &ckpt);
+        build = now() - start;
+
+        printf("%s: %zu checkpoints built in %.2f ms\n", tles[s][0], ckpt.nfwd + ckpt.nbwd, build * 1e3);
+        printf("  distance (days)   plain (ns/query)   checkpoints (ns/query)\n");
+
+        for(d = 0; d < sizeof(distances) / sizeof(distances[0]); d++)
+        {
+            for(i = 0; i < QUERIES; i++)
+            {
+                times[i] = (distances[d] - rand() / (double)RAND_MAX) * DAY;
+                if (rand() & 1)
+                {
+                    times[i] = -times[i];
+                }
+            }
+
+            printf("  %15.0f   %16.0f   %22.0f\n", distances[d],
+                   bench(&satrec, NULL, times), bench(&satrec, &ckpt, times));
+        }
+
+        sgp4_ckpt_free(&ckpt);
+    }
+
+    return 0;
+}
+
+/** \} End of sgp4_ckpt_bench group */
@@ -0,0 +1,161 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Accuracy report of the single precision propagation.
+ *
+ * Compares sgp4f and rv2azelf against sgp4 and rv2azel on near earth and deep space test
+ * records, and prints the largest position, azimuth and elevation errors in bins of time
+ * since epoch. Look angle errors are only taken while the satellite is above the horizon
+ * of the site ("-" when it never is).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4_float_report SGP4 Float Report
+ * \ingroup examples
+ * \{
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <sgp4/sgp4io.h>
+#include <sgp4/sgp4coord.h>
+#include <sgp4/sgp4float.h>
+
+#define STEP    1.0     /* minutes */
+#define BINS    4
+
+static const char *tles[][3] =
+{
+    {"LEO 25544",       "1 25544U 98067A   08264.51782528 -.00002182  00000-0 -11606-4 0  2927",
+                        "2 25544  51.6416 247.4627 0006703 130.5360 325.0288 15.72125391563537"},
+    {"LEO 28057",       "1 28057U 03049A   06177.78615833  .00000060  00000-0  35940-4 0  1836",
+                        "2 28057  98.7183 240.4130 0001072  66.7454 293.3856 14.21211300142005"},
+    {"LEO 06251",       "1 06251U 62025E   06176.82412014  .00008885  00000-0  12808-3 0  3985",
+                        "2 06251  58.0579  54.0425 0030035 139.1568 221.1854 15.56387291  6774"},
+    {"Molniya 09880",   "1 09880U 77021A   06176.56157475  .00000421  00000-0  10000-3 0  9814",
+                        "2 09880  64.5968 349.3786 7069051 270.0229  16.3320  2.00813614112380"},
+    {"GEO 28626",       "1 28626U 05008A   06176.46683397 -.00000205  00000-0  10000-3 0  2190",
+                        "2 28626   0.0019 286.9433 0000335  13.7918  55.6504  1.00270176  4891"},
+    {"GEO 14128",       "1 14128U 83058A   06176.02844893 -.00000158  00000-0  10000-3 0  9627",
+                        "2 14128  11.4384  35.2134 0011562  26.4582 333.5652  0.98870114 46093"},
+};
+
+static const double bins[BINS + 1] = {0.0, 60.0, 1440.0, 7.0 * 1440.0, 30.0 * 1440.0};
+static const char *names[BINS] = {"0-1 h", "1-24 h", "1-7 d", "7-30 d"};
+
+int main(void)
+{
+    char line1[130], line2[130];
+    double r[3], v[3], razel[3], tsince, dr, daz, del;
+    float rf[3], vf[3], razelf[3];
+    double maxdr[BINS], maxdaz[BINS], maxdel[BINS];
+    int visible[BINS];
+    elsetrec satrec;
+    elsetrecf satrecf;
+    size_t s;
+    int b;
+
+    /* Mid latitude site, 45 deg N, 0 deg E, 0.5 km */
+    const double lat = 45.0 * pi / 180.0, lon = 0.0, alt = 0.5;
+
+    printf("%-14s  %-7s  %12s  %12s  %12s\n", "object", "span", "pos err (km)", "az err (deg)", "el err (deg)");
+
+    for(s = 0; s < sizeof(tles) / sizeof(tles[0]); s++)
+    {
+        strcpy(line1, tles[s][1]);
+        strcpy(line2, tles[s][2]);
+        twoline2rv(line1, line2, 'i', wgs72, &satrec);
+        elsetrec2f(&satrec, &satrecf);
+
+        for(b = 0; b < BINS; b++)
+        {
+            maxdr[b] = maxdaz[b] = maxdel[b] = 0.0;
+            visible[b] = 0;
+        }
+
+        for(b = 0; b < BINS; b++)
+        {
+            for(tsince = bins[b]; tsince < bins[b + 1]; tsince += STEP * (b + 1))
+            {
+                if (!sgp4(wgs72, &satrec, tsince, r, v) || !sgp4f(wgs72, &satrecf, (float)tsince, rf, vf))
+                {
+                    continue;
+                }
+
+                dr = sqrt((r[0] - rf[0]) * (r[0] - rf[0]) + (r[1] - rf[1]) * (r[1] - rf[1]) +
+                          (r[2] - rf[2]) * (r[2] - rf[2]));
+                if (dr > maxdr[b])
+                {
+                    maxdr[b] = dr;
+                }
+
+                /* Look angles only matter above the horizon */
+                rv2azel(r, lat, lon, alt, satrec.jdsatepoch + tsince / 1440.0, razel);
+                if (razel[2] < 0.0)
+                {
+                    continue;
+                }
+                visible[b]++;
+                rv2azelf(rf, (float)lat, (float)lon, (float)alt, satrec.jdsatepoch + tsince / 1440.0, razelf);
+
+                daz = fabs(remainder(razel[1] - razelf[1], 2.0 * pi)) * 180.0 / pi;
+                del = fabs(razel[2] - razelf[2]) * 180.0 / pi;
+                if (daz > maxdaz[b])
+                {
+                    maxdaz[b] = daz;
+                }
+                if (del > maxdel[b])
+                {
+                    maxdel[b] = del;
+                }
+            }
+        }
+
+        for(b = 0; b < BINS; b++)
+        {
+            if (visible[b] > 0)
+            {
+                printf("%-14s  %-7s  %12.4f  %12.5f  %12.5f\n", tles[s][0], names[b], maxdr[b], maxdaz[b], maxdel[b]);
+            }
+            else
+            {
+                printf("%-14s  %-7s  %12.4f  %12s  %12s\n", tles[s][0], names[b], maxdr[b], "-", "-");
+            }
+        }
+    }
+
+    return 0;
+}
+
+/** \} End of sgp4_float_report group */
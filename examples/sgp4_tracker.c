@@ -82,6 +82,32 @@ void second_tick(void)
     framerate = 0;
 }
 
+/* Tracks a record after its decay, where each query falls back to the full sgp4 and reports the error */
+void decay_check(void)
+{
+    Sgp4 deb;
+    unsigned long t;
+    int failed = 0;
+
+    char debname[] = "DECAYING";
+    char deb_line1[] = "1 00001U 00001A   20001.00000000  .00000000  00000-0  20000-2 0    09";
+    char deb_line2[] = "2 00001  51.6000 100.0000 0001000 100.0000 100.0000 15.95000000    09";
+
+    deb.init(debname, deb_line1, deb_line2);
+    deb.track(0.01);
+
+    for(t = 1577836800 + 19 * 86400; t < 1577836800 + 20 * 86400; t += 60)  /* Day 19 to 20 after the epoch */
+    {
+        deb.findsat(t);
+        if (deb.satrec.error != 0)
+        {
+            failed += 1;
+        }
+    }
+
+    printf("Decayed record: sgp4 error at %d of 1440 queries\n\r", failed);
+}
+
 int main()
 {
     sat.site(-0.5276847, 166.9359231, 34);  /* set site latitude[°], longitude[°] and altitude[m] */
@@ -91,12 +117,15 @@ int main()
     char tle_line2[] = "2 25544  51.6436 216.3171 0002750 185.0333 238.0864 15.54246933988812"; /* Line two from the TLE data */
   
     sat.init(satname, tle_line1, tle_line2);    /* initialize satellite parameters */
+    sat.track(0.001);                           /* interpolate between sgp4 anchors, within 1 m */
 
     /* Display TLE epoch time */
     double jdC = sat.satrec.jdsatepoch;
     invjday(jdC , timezone, true, year, mon, day, hr, minute, sec);
     printf("Epoch: %d/%d/%d %d:%d:%d\n\r", day, mon, year, hr, minute, sec);
 
+    decay_check();
+
     tkSecond.attach(1, second_tick);
 
     while(1)
@@ -41,7 +41,16 @@
 #ifndef BRENT_H_
 #define BRENT_H_
 
-#include "sgp4pred.h"
+/**
+ * \brief Function minimised by brentmin or solved by zbrent.
+ *
+ * \param[in,out] obj is the object given to brentmin or zbrent.
+ *
+ * \param[in] x is the abscissa.
+ *
+ * \return The function value at x.
+ */
+typedef double (*brentfunc)(void *obj, double x);
 
 /**
  * \brief .
@@ -58,17 +67,17 @@
  *
  * \param[in] cx .
  *
- * \param[in] .
+ * \param[in] f is the function to minimise.
  *
  * \param[in] tol .
  *
  * \param[in] xmin .
  *
- * \param[in] obj .
+ * \param[in] obj is passed to f.
  *
  * \return .
  */
-double brentmin(double ax, double bx, double cx, double (Sgp4::*f)(double), double tol, double *xmin,  Sgp4* obj);
+double brentmin(double ax, double bx, double cx, brentfunc f, double tol, double *xmin, void *obj);
 
 /**
  * \brief .
@@ -76,7 +85,7 @@ double brentmin(double ax, double bx, double cx, double (Sgp4::*f)(double), doub
  * Using Brent’s method, find the root of a function func known to lie between x1 and x2. The
  * root, returned as zbrent, will be refined until its accuracy is tol.
  *
- * \param[in] .
+ * \param[in] func is the function to solve.
  *
  * \param[in] x1 .
  *
@@ -84,11 +93,11 @@ double brentmin(double ax, double bx, double cx, double (Sgp4::*f)(double), doub
  *
  * \param[in] tol .
  *
- * \param[in] .
+ * \param[in] obj is passed to func.
  *
  * \return .
  */
-double zbrent(double (Sgp4::*func)(double), double x1, double x2, double tol, Sgp4* obj);
+double zbrent(brentfunc func, double x1, double x2, double tol, void *obj);
 
 #endif /* BRENT_H_ */
 
@@ -0,0 +1,116 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Parallel initialisation of a whole catalog.
+ *
+ * Catalog startup is dominated by twoline2rv and sgp4init, which for deep space records
+ * also runs dscom, dsinit and dpper. sgp4_bulk_init spreads the records over a pool of
+ * POSIX threads, which take chunks of SGP4_BULK_CHUNK records from a shared counter so that
+ * clusters of deep space records do not leave threads idle. Every record gets its own status
+ * and a bad element set never stops the batch.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4bulk SGP4 Bulk
+ * \{
+ */
+
+#ifndef SGP4BULK_H_
+#define SGP4BULK_H_
+
+#include <stddef.h>
+
+#include "sgp4unit.h"
+
+/**
+ * \brief Records taken by a thread at a time.
+ */
+#define SGP4_BULK_CHUNK     64
+
+/**
+ * \brief Status of a record initialised successfully.
+ *
+ * Positive status values are the sgp4init error codes (1 to 6).
+ */
+#define SGP4_BULK_OK        0
+
+/**
+ * \brief Status of a record whose lines are shorter than 69 characters, do not start with
+ * '1 ' and '2 ', or have different catalog numbers. The record is left untouched.
+ */
+#define SGP4_BULK_EFORMAT   (-1)
+
+/**
+ * \brief Counters and timing of a bulk initialisation.
+ */
+typedef struct
+{
+    double seconds;     /* Wall clock time of the whole call (sec) */
+    int nthreads;       /* Threads used, including the calling one */
+    size_t nok;         /* Records initialised without error */
+    size_t nfail;       /* Records with a format or sgp4init error */
+    size_t ndeep;       /* Deep space records (method 'd') among the initialised ones */
+} sgp4_bulkstats_t;
+
+/**
+ * \brief Initialises an array of records from their two line elements, in parallel.
+ *
+ * Each record is initialised as by twoline2rv, so results are identical to the serial
+ * calls. Like twoline2rv, the lines are modified.
+ *
+ * \param[in] whichconst is the set of gravity constants.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in,out] line1 is the first line of each record.
+ *
+ * \param[in,out] line2 is the second line of each record.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \param[in] nthreads is the number of threads to use, or 0 for one per online processor.
+ *
+ * \param[in,out] satrecs is the array of n records to initialise.
+ *
+ * \param[in,out] status is the status of each record (SGP4_BULK_OK, SGP4_BULK_EFORMAT or an
+ * sgp4init error code). It can be NULL.
+ *
+ * \param[in,out] stats receives the counters and timing. It can be NULL.
+ *
+ * \return The number of records initialised without error.
+ */
+size_t sgp4_bulk_init(gravconsttype whichconst, char opsmode, char *line1[], char *line2[], size_t n,
+                      int nthreads, elsetrec satrecs[], int status[], sgp4_bulkstats_t *stats);
+
+#endif /* SGP4BULK_H_ */
+
+/** \} End of sgp4bulk group */
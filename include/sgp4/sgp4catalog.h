@@ -0,0 +1,237 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Catalog of element sets indexed by satellite number, with the history of each object.
+ *
+ * Each object keeps all its element sets in one array sorted by epoch, and an open
+ * addressing hash table (linear probing, at most half full) maps satellite numbers to
+ * objects. Finding an object takes constant time and finding the element set for a given
+ * time is a binary search over the history of the object.
+ *
+ * The history also gives back-testing: sgp4_catalog_replay predicts with the element set
+ * that was the latest one at a past date, and sgp4_catalog_backtest measures how far each
+ * element set drifted from the later ones of the same object.
+ *
+ * Propagation goes through sgp4_r, so queries do not modify the catalog and can run from
+ * several threads at once. Adding element sets cannot run at the same time as queries.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4catalog SGP4 Catalog
+ * \{
+ */
+
+#ifndef SGP4CATALOG_H_
+#define SGP4CATALOG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+#include "sgp4reader.h"
+
+/**
+ * \brief Element sets of one object.
+ */
+typedef struct
+{
+    long satnum;
+    elsetrec *satrecs;      /* Initialized element sets, sorted by epoch (jdsatepoch) */
+    size_t n, cap;
+} sgp4_history_t;
+
+/**
+ * \brief Catalog of objects.
+ */
+typedef struct
+{
+    gravconsttype whichconst;   /* Gravity constants the element sets were initialized with */
+    sgp4_history_t *objects;    /* Objects in the order they were added */
+    size_t nobjects, capobjects;
+    uint32_t *table;            /* Index plus one of the object in each slot, 0 when free */
+    size_t tablesize;           /* Slots of the table, a power of two */
+    size_t nrecords;            /* Element sets of all the objects */
+} sgp4_catalog_t;
+
+/**
+ * \brief Result of the comparison of two element sets of an object.
+ */
+typedef struct
+{
+    double jdfrom;      /* Epoch of the element set used for the prediction (julian date) */
+    double jdto;        /* Epoch of the later element set taken as reference (julian date) */
+    double error;       /* Distance between the two positions at jdto (km) */
+} sgp4_backtest_t;
+
+/**
+ * \brief Creates an empty catalog.
+ *
+ * \param[in,out] cat is the catalog, to be released with sgp4_catalog_free.
+ *
+ * \param[in] whichconst is the set of gravity constants of the element sets.
+ *
+ * \param[in] nobjects is the expected number of objects, or 0.
+ *
+ * \return TRUE/FALSE if the catalog was created or not.
+ */
+bool sgp4_catalog_init(sgp4_catalog_t *cat, gravconsttype whichconst, size_t nobjects);
+
+/**
+ * \brief Releases a catalog.
+ *
+ * \param[in,out] cat is the catalog.
+ *
+ * \return None.
+ */
+void sgp4_catalog_free(sgp4_catalog_t *cat);
+
+/**
+ * \brief Adds an element set to the history of its object.
+ *
+ * The element set is copied. One with the same epoch as an element set already in the
+ * history replaces it. Pointers previously returned by the catalog may become invalid.
+ *
+ * \param[in,out] cat is the catalog.
+ *
+ * \param[in] satrec is the initialized element set.
+ *
+ * \return TRUE/FALSE if the element set was added or memory ran out.
+ */
+bool sgp4_catalog_add(sgp4_catalog_t *cat, const elsetrec *satrec);
+
+/**
+ * \brief Adds every valid entry of a catalog file.
+ *
+ * \param[in,out] cat is the catalog.
+ *
+ * \param[in,out] rd is the reader of the file.
+ *
+ * \param[in] checksum enables the check of the checksum of both lines.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \return The number of element sets added. Entries that fail to decode are skipped.
+ */
+size_t sgp4_catalog_load(sgp4_catalog_t *cat, sgp4_reader_t *rd, bool checksum, char opsmode);
+
+/**
+ * \brief Finds an object.
+ *
+ * \param[in] cat is the catalog.
+ *
+ * \param[in] satnum is the satellite number.
+ *
+ * \return The history of the object, or NULL if it is not in the catalog.
+ */
+const sgp4_history_t *sgp4_catalog_find(const sgp4_catalog_t *cat, long satnum);
+
+/**
+ * \brief Chooses the element set of an object to use at a given time.
+ *
+ * \param[in] cat is the catalog.
+ *
+ * \param[in] satnum is the satellite number.
+ *
+ * \param[in] jd is the julian date.
+ *
+ * \param[in] past limits the choice to element sets with epoch up to jd (the latest one known
+ * at jd) instead of the one with the nearest epoch.
+ *
+ * \return The element set, or NULL if there is none.
+ */
+const elsetrec *sgp4_catalog_best(const sgp4_catalog_t *cat, long satnum, double jd, bool past);
+
+/**
+ * \brief Propagates an object with the element set of epoch nearest to the given time.
+ *
+ * \param[in] cat is the catalog.
+ *
+ * \param[in] satnum is the satellite number.
+ *
+ * \param[in] jd is the julian date.
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not.
+ */
+bool sgp4_catalog_propagate(const sgp4_catalog_t *cat, long satnum, double jd, double r[3], double v[3]);
+
+/**
+ * \brief Propagates an object as it would have been predicted at a past date.
+ *
+ * Uses the latest element set with epoch up to jdissue.
+ *
+ * \param[in] cat is the catalog.
+ *
+ * \param[in] satnum is the satellite number.
+ *
+ * \param[in] jdissue is the julian date the prediction is made at.
+ *
+ * \param[in] jd is the julian date to predict.
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not.
+ */
+bool sgp4_catalog_replay(const sgp4_catalog_t *cat, long satnum, double jdissue, double jd, double r[3],
+                         double v[3]);
+
+/**
+ * \brief Compares each element set of an object with the later ones.
+ *
+ * Each element set is propagated to the epoch of every later element set within maxspan
+ * days, and the result is compared with the position of the later element set at its
+ * epoch. Pairs where either propagation fails are skipped.
+ *
+ * \param[in] cat is the catalog.
+ *
+ * \param[in] satnum is the satellite number.
+ *
+ * \param[in] maxspan is the longest prediction to check (days).
+ *
+ * \param[in,out] out receives the comparisons, ordered by jdfrom and jdto.
+ *
+ * \param[in] max is the size of out.
+ *
+ * \return The number of comparisons written.
+ */
+size_t sgp4_catalog_backtest(const sgp4_catalog_t *cat, long satnum, double maxspan, sgp4_backtest_t out[],
+                             size_t max);
+
+#endif /* SGP4CATALOG_H_ */
+
+/** \} End of sgp4catalog group */
@@ -0,0 +1,154 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Chebyshev ephemeris of a satellite.
+ *
+ * sgp4 output over a time span is fitted with piecewise Chebyshev polynomials, one set per
+ * position axis and segment. The segment length starts at a quarter of the orbital period
+ * and is halved until the position error, checked against sgp4 between the fit nodes, is
+ * below the requested tolerance. For resonant deep space records the segments also end on
+ * the 720 minute steps of the resonance integrator. Evaluating a fit costs a segment search
+ * and a Chebyshev sum per axis, about 0.1 us against 0.4 to 1.2 us for sgp4.
+ *
+ * The velocity is the derivative of the fitted position. sgp4's own velocity is not exactly
+ * the derivative of its position: the two differ by up to about 1e-4 km/s for near circular
+ * orbits and 1e-3 km/s for eccentric ones, and the fitted velocity differs from sgp4 by the
+ * same amount.
+ *
+ * A fit only reads the record and can be saved with sgp4_cheb_write and shared by many
+ * readers.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4cheb SGP4 Chebyshev
+ * \{
+ */
+
+#ifndef SGP4CHEB_H_
+#define SGP4CHEB_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+
+#define SGP4_CHEB_ORDER     12      /* Default polynomial order */
+#define SGP4_CHEB_MAXORDER  31      /* Highest polynomial order */
+
+/**
+ * \brief Piecewise Chebyshev fit of one satellite.
+ */
+typedef struct
+{
+    long int satnum;
+    double jdsatepoch;  /* Julian date of the epoch of the fitted record */
+    int order;          /* Polynomial order, order + 1 coefficients per axis */
+    size_t nseg;        /* Number of segments */
+    double *tseg;       /* nseg + 1 segment bounds (minutes from epoch) */
+    double *coef;       /* 3 * (order + 1) position coefficients (km) per segment */
+} sgp4_cheb_t;
+
+/**
+ * \brief Fits a record over a time span.
+ *
+ * \param[in] whichconst is the set of gravity constants used to initialise the record.
+ *
+ * \param[in] satrec is the record initialised by sgp4init or twoline2rv. It is not modified.
+ *
+ * \param[in] tstart is the start of the span (minutes from epoch).
+ *
+ * \param[in] tstop is the end of the span (minutes from epoch).
+ *
+ * \param[in] tol is the position tolerance (km), checked at both ends of each segment and
+ * halfway between its nodes.
+ *
+ * \param[in] order is the polynomial order, from 2 to SGP4_CHEB_MAXORDER, or 0 for
+ * SGP4_CHEB_ORDER.
+ *
+ * \param[in,out] cheb is the fit. It must be released with sgp4_cheb_free.
+ *
+ * \return TRUE/FALSE if the fit was done or not. It fails when sgp4 returns an error inside
+ * the span or when out of memory.
+ */
+bool sgp4_cheb_fit(gravconsttype whichconst, const elsetrec *satrec, double tstart, double tstop,
+                   double tol, int order, sgp4_cheb_t *cheb);
+
+/**
+ * \brief Releases the memory of a fit.
+ *
+ * \param[in,out] cheb is the fit to release.
+ *
+ * \return None.
+ */
+void sgp4_cheb_free(sgp4_cheb_t *cheb);
+
+/**
+ * \brief Evaluates a fit.
+ *
+ * \param[in] cheb is the fit.
+ *
+ * \param[in] tsince is the time since epoch (minutes).
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s). It can be NULL.
+ *
+ * \return TRUE/FALSE if tsince is inside the fitted span or not.
+ */
+bool sgp4_cheb_eval(const sgp4_cheb_t *cheb, double tsince, double r[3], double v[3]);
+
+/**
+ * \brief Writes a fit to a binary file.
+ *
+ * \param[in] cheb is the fit.
+ *
+ * \param[in] f is the file, opened for binary writing.
+ *
+ * \return TRUE/FALSE if the fit was written or not.
+ */
+bool sgp4_cheb_write(const sgp4_cheb_t *cheb, FILE *f);
+
+/**
+ * \brief Reads a fit written by sgp4_cheb_write.
+ *
+ * \param[in,out] cheb is the fit. It must be released with sgp4_cheb_free.
+ *
+ * \param[in] f is the file, opened for binary reading.
+ *
+ * \return TRUE/FALSE if the fit was read or not.
+ */
+bool sgp4_cheb_read(sgp4_cheb_t *cheb, FILE *f);
+
+#endif /* SGP4CHEB_H_ */
+
+/** \} End of sgp4cheb group */
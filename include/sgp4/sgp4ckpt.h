@@ -0,0 +1,152 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Checkpointed deep space resonance integrator.
+ *
+ * For resonant records (irez 1 and 2) sgp4 integrates the resonance terms in 720 minute
+ * steps from epoch, or from the last time reached. A checkpoint table stores the
+ * integrator state (atime, xli, xni) at fixed multiples of 720 minutes on both sides of
+ * epoch, so any query resumes from the nearest checkpoint before it. The integrator path
+ * is the same as the one from epoch, so the results are identical to sgp4().
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4ckpt SGP4 Checkpoints
+ * \{
+ */
+
+#ifndef SGP4CKPT_H_
+#define SGP4CKPT_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+
+/**
+ * \brief Resonance integrator state at one checkpoint.
+ */
+typedef struct
+{
+    double atime;   /* Time of the checkpoint (minutes from epoch) */
+    double xli;
+    double xni;
+} sgp4_ckpt_point_t;
+
+/**
+ * \brief Checkpoint table of one satellite.
+ *
+ * Checkpoint k (from 0) of each side is at (k + 1) * spacing minutes from epoch. The table
+ * is empty for records without resonance.
+ */
+typedef struct
+{
+    double spacing;             /* Minutes between checkpoints, a multiple of 720 */
+    size_t nfwd;                /* Number of checkpoints after epoch */
+    size_t nbwd;                /* Number of checkpoints before epoch */
+    sgp4_ckpt_point_t *fwd;     /* Checkpoints after epoch */
+    sgp4_ckpt_point_t *bwd;     /* Checkpoints before epoch */
+} sgp4_ckpt_t;
+
+/**
+ * \brief Builds the checkpoint table of a record.
+ *
+ * The cost is one integration from epoch to tmin and to tmax. Queries outside the range
+ * resume from the last checkpoint on their side.
+ *
+ * \param[in] whichconst is the set of gravity constants used to initialise the record.
+ *
+ * \param[in] satrec is the record initialised by sgp4init or twoline2rv.
+ *
+ * \param[in] tmin is the earliest time covered (minutes from epoch).
+ *
+ * \param[in] tmax is the latest time covered (minutes from epoch).
+ *
+ * \param[in] spacing is the time between checkpoints (minutes), rounded up to a multiple of
+ * 720. With 720, a query runs at most one integrator step.
+ *
+ * \param[in,out] ckpt is the table to build. It must be released with sgp4_ckpt_free.
+ *
+ * \return TRUE/FALSE if the table was built or not.
+ */
+bool sgp4_ckpt_build(gravconsttype whichconst, const elsetrec *satrec, double tmin, double tmax,
+                     double spacing, sgp4_ckpt_t *ckpt);
+
+/**
+ * \brief Releases the memory of a checkpoint table.
+ *
+ * \param[in,out] ckpt is the table to release.
+ *
+ * \return None.
+ */
+void sgp4_ckpt_free(sgp4_ckpt_t *ckpt);
+
+/**
+ * \brief Loads the nearest checkpoint before tsince into a propagation context.
+ *
+ * The context is left as it is when its own state is already closer to tsince.
+ *
+ * \param[in] ckpt is the checkpoint table of the record.
+ *
+ * \param[in,out] ctx is the context used with sgp4_r.
+ *
+ * \param[in] tsince is the time of the next query (minutes from epoch).
+ *
+ * \return None.
+ */
+void sgp4_ckpt_seed(const sgp4_ckpt_t *ckpt, sgp4_ctx_t *ctx, double tsince);
+
+/**
+ * \brief Propagates a record starting from its nearest checkpoint.
+ *
+ * \param[in] whichconst is the set of gravity constants used to initialise the record.
+ *
+ * \param[in] satrec is the record initialised by sgp4init or twoline2rv.
+ *
+ * \param[in] ckpt is the checkpoint table of the record.
+ *
+ * \param[in,out] ctx is a context reset by sgp4_ctx_init or previously used with satrec.
+ *
+ * \param[in] tsince is the time since epoch (minutes).
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not (see ctx->error).
+ */
+bool sgp4_ckpt(gravconsttype whichconst, const elsetrec *satrec, const sgp4_ckpt_t *ckpt,
+               sgp4_ctx_t *ctx, double tsince, double r[3], double v[3]);
+
+#endif /* SGP4CKPT_H_ */
+
+/** \} End of sgp4ckpt group */
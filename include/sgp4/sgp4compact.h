@@ -0,0 +1,175 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Compact records split into hot, deep space and cold parts.
+ *
+ * elsetrec keeps about a hundred doubles inline, and for near earth records (most of a
+ * catalog) the deep space block is all zeros. elsetrechot keeps only what sgp4 reads for a
+ * near earth record (about 300 bytes instead of about 800), points to an elsetrecdeep
+ * allocated only for deep space records (method 'd'), and leaves the metadata that sgp4
+ * never reads (epoch as year and day, ndot, nddot, a, alta, altp, rcse) in elsetreccold,
+ * which can be stored elsewhere. A sweep over an array of elsetrechot touches a third of the
+ * memory of the same sweep over elsetrec.
+ *
+ * sgp4hot gives the same results as sgp4. Near earth records are propagated straight from
+ * the hot record; deep space records are expanded to an elsetrec on the stack.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4compact SGP4 Compact
+ * \{
+ */
+
+#ifndef SGP4COMPACT_H_
+#define SGP4COMPACT_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+
+/**
+ * \brief Deep space part of a record, including the resonance integrator state.
+ */
+typedef struct elsetrecdeep
+{
+    int irez;
+    double d2201,   d2211,  d3210,  d3222,  d4410,  d4422,  d5220,  d5232,
+           d5421,   d5433,  dedt,   del1,   del2,   del3,   didt,   dmdt,
+           dnodt,   domdt,  e3,     ee2,    peo,    pgho,   pho,    pinco,
+           plo,     se2,    se3,    sgh2,   sgh3,   sgh4,   sh2,    sh3,
+           si2,     si3,    sl2,    sl3,    sl4,    gsto,   xfact,  xgh2,
+           xgh3,    xgh4,   xh2,    xh3,    xi2,    xi3,    xl2,    xl3,
+           xl4,     xlamo,  zmol,   zmos,   atime,  xli,    xni;
+} elsetrecdeep;
+
+/**
+ * \brief Fields of a record used by the propagation.
+ */
+typedef struct elsetrechot
+{
+    long int satnum;
+    int error;
+    char operationmode;
+    char init, method;
+    int isimp;
+    int variant;
+    double t, jdsatepoch;
+    double aycof,   con41,  cc1,        cc4,    cc5,    d2,         d3,     d4,
+           delmo,   eta,    argpdot,    omgcof, sinmao, t2cof,      t3cof,  t4cof,
+           t5cof,   x1mth2, x7thm1,     mdot,   nodedot, xlcof,     xmcof,  nodecf;
+    double bstar,   inclo,  nodeo,      ecco,   argpo,  mo,         no;
+    elsetrecdeep *deep;     /* Deep space part, NULL for near earth records */
+} elsetrechot;
+
+/**
+ * \brief Fields of a record not used by the propagation.
+ */
+typedef struct elsetreccold
+{
+    int epochyr, epochtynumrev;
+    double epochdays, ndot, nddot, a, alta, altp, rcse;
+} elsetreccold;
+
+/**
+ * \brief Splits an initialised record.
+ *
+ * \param[in] satrec is the record initialised by sgp4init or twoline2rv.
+ *
+ * \param[in,out] hot receives the fields used by the propagation, to be released with
+ * elsetrechot_free.
+ *
+ * \param[in,out] cold receives the other fields. It can be NULL.
+ *
+ * \return TRUE/FALSE if the record was split or the deep space part could not be allocated.
+ */
+bool elsetrec2hot(const elsetrec *satrec, elsetrechot *hot, elsetreccold *cold);
+
+/**
+ * \brief Joins the parts of a record back into an elsetrec.
+ *
+ * \param[in] hot is the record.
+ *
+ * \param[in] cold is the metadata of the record. It can be NULL, leaving those fields zero.
+ *
+ * \param[in,out] satrec receives the record.
+ *
+ * \return None.
+ */
+void elsetrechot2rec(const elsetrechot *hot, const elsetreccold *cold, elsetrec *satrec);
+
+/**
+ * \brief Releases the deep space part of a record.
+ *
+ * \param[in,out] hot is the record.
+ *
+ * \return None.
+ */
+void elsetrechot_free(elsetrechot *hot);
+
+/**
+ * \brief sgp4 on a compact record.
+ *
+ * \param[in] whichconst is the set of gravity constants used to initialise the record.
+ *
+ * \param[in,out] hot is the record.
+ *
+ * \param[in] tsince is the time since epoch (minutes).
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not (see hot->error).
+ */
+bool sgp4hot(gravconsttype whichconst, elsetrechot *hot, double tsince, double r[3], double v[3]);
+
+/**
+ * \brief Propagates an array of compact records to the same julian date (see sgp4_batch).
+ *
+ * \param[in] whichconst is the gravity model used to initialize the records.
+ *
+ * \param[in,out] hots is the array of records.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \param[in] jd is the julian date to propagate to.
+ *
+ * \param[in,out] out is the structure-of-arrays output.
+ *
+ * \return The number of records propagated without error.
+ */
+size_t sgp4hot_batch(gravconsttype whichconst, elsetrechot hots[], size_t n, double jd, sgp4_soa_t *out);
+
+#endif /* SGP4COMPACT_H_ */
+
+/** \} End of sgp4compact group */
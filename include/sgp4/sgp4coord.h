@@ -54,7 +54,29 @@ Ported to C++ by Grady Hillhouse with some modifications, July 2015.
 #include <math.h>
 #include <string.h>
 
-//void teme2ecef(double rteme[3], double vteme[3], double jdut1, double recef[3], double vecef[3]);
+/**
+ * \brief Quantities that only depend on the julian date (see frameinit).
+ */
+typedef struct
+{
+    double jdut1;           /* Julian date (days) */
+    double gmst;            /* Greenwich mean sidereal time of the UT1 date (rad) (see sgp4_eop_use) */
+    double st[3][3];        /* PEF - TOD matrix (see teme2ecef) */
+    double pm[3][3];        /* Polar motion matrix (see polarm) */
+    double rsun[3];         /* Sun position vector (see sun) (km) */
+} sgp4_frame_t;
+
+/**
+ * \brief Quantities that only depend on the site (see observerinit).
+ */
+typedef struct
+{
+    double latgd, lon, alt;         /* Site geodetic latitude (rad), longitude (rad) and altitude (km) */
+    double rs[3];                   /* Site position vector (ECEF) (km) */
+    double south[3], east[3], up[3];    /* SEZ unit vectors (ECEF) */
+    double clon, slon;              /* Cosine and sine of the longitude */
+    double ccolat, scolat;          /* Cosine and sine of the colatitude */
+} sgp4_observer_t;
 
 /**
  * \brief .
@@ -69,6 +91,26 @@ Ported to C++ by Grady Hillhouse with some modifications, July 2015.
  */
 void teme2ecef(double rteme[3], double jdut1, double recef[3]);
 
+/**
+ * \brief Transforms a position and velocity from TEME to ECEF.
+ *
+ * The velocity is corrected for the rotation of the earth, so it is the velocity relative
+ * to the ground.
+ *
+ * \param[in] rteme is the position vector in TEME (km).
+ *
+ * \param[in] vteme is the velocity vector in TEME (km/s).
+ *
+ * \param[in] jdut1 is the julian date (days).
+ *
+ * \param[in] recef is the position vector in ECEF (km).
+ *
+ * \param[in] vecef is the velocity vector in ECEF (km/s).
+ *
+ * \return None.
+ */
+void teme2ecefv(double rteme[3], double vteme[3], double jdut1, double recef[3], double vecef[3]);
+
 /**
  * \brief .
  *
@@ -80,6 +122,98 @@ void teme2ecef(double rteme[3], double jdut1, double recef[3]);
  */
 void polarm(double jdut1, double pm[3][3]);
 
+/**
+ * \brief Calculates the sun coordinates.
+ *
+ * This function calculates the geocentric equatorial position vector
+ * the sun given the julian date. This is the low precision formula and
+ * is valid for years from 1950 to 2050. Accuaracy of apparent coordinates
+ * is 0.01 degrees. Notice many of the calculations are performed in
+ * degrees, and are not changed until later. This is due to the fact that
+ * the almanac uses degrees exclusively in their formulations.
+ *
+ * \param[in] jd .
+ *
+ * \param[in] rsun .
+ *
+ * \return None.
+ */
+void sun(double jd, double rsun[3]);
+
+/**
+ * \brief Computes the frame of a julian date.
+ *
+ * Holds the sidereal time, the polar motion matrix and the sun vector, so that the
+ * satellites evaluated at the same date share them instead of computing them on each call.
+ *
+ * \param[in] jdut1 is the julian date (days).
+ *
+ * \param[in,out] frame is the frame.
+ *
+ * \return None.
+ */
+void frameinit(double jdut1, sgp4_frame_t *frame);
+
+/**
+ * \brief Computes the frame of a julian date, except the sun vector.
+ *
+ * \param[in] jdut1 is the julian date (days).
+ *
+ * \param[in,out] frame is the frame, rsun is left unchanged.
+ *
+ * \return None.
+ */
+void framerotation(double jdut1, sgp4_frame_t *frame);
+
+/**
+ * \brief teme2ecef with the rotation of a frame.
+ *
+ * \param[in] rteme is the position vector in TEME (km).
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit).
+ *
+ * \param[in] recef is the position vector in ECEF (km).
+ *
+ * \return None.
+ */
+void teme2ecef_frame(const double rteme[3], const sgp4_frame_t *frame, double recef[3]);
+
+/**
+ * \brief teme2ecefv with the rotation of a frame.
+ *
+ * \param[in] rteme is the position vector in TEME (km).
+ *
+ * \param[in] vteme is the velocity vector in TEME (km/s).
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit).
+ *
+ * \param[in] recef is the position vector in ECEF (km).
+ *
+ * \param[in] vecef is the velocity vector in ECEF (km/s).
+ *
+ * \return None.
+ */
+void teme2ecefv_frame(const double rteme[3], const double vteme[3], const sgp4_frame_t *frame, double recef[3], double vecef[3]);
+
+/**
+ * \brief rv2azel with the rotation of a frame.
+ *
+ * \param[in] ro is the satellite position vector in TEME (km).
+ *
+ * \param[in] latgd is the site geodetic latitude (rad).
+ *
+ * \param[in] lon is the site longitude (rad).
+ *
+ * \param[in] alt is the site altitude (km).
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit).
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \return None.
+ */
+void rv2azel_frame(const double ro[3], double latgd, double lon, double alt, const sgp4_frame_t *frame, double razel[3]);
+
 /**
  * \brief .
  *
@@ -108,8 +242,6 @@ void ijk2ll(double r[3], double latlongh[3]);
  */
 void site(double latgd, double lon, double alt, double rs[3]);
 
-//void rv2azel(double ro[3], double vo[3], double latgd, double lon, double alt, double jdut1, double razel[3], double razelrates[3]);
-
 /**
  * \brief .
  *
@@ -129,6 +261,146 @@ void site(double latgd, double lon, double alt, double rs[3]);
  */
 void rv2azel(double ro[3], double latgd, double lon, double alt, double jdut1, double razel[3]);
 
+/**
+ * \brief rv2azel with the range rate, azimuth rate and elevation rate.
+ *
+ * \param[in] ro is the satellite position vector in TEME (km).
+ *
+ * \param[in] vo is the satellite velocity vector in TEME (km/s).
+ *
+ * \param[in] latgd is the site geodetic latitude (rad).
+ *
+ * \param[in] lon is the site longitude (rad).
+ *
+ * \param[in] alt is the site altitude (km).
+ *
+ * \param[in] jdut1 is the julian date (days).
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \param[in] razelrates is the range rate (km/s), azimuth rate (rad/s) and elevation rate (rad/s).
+ *
+ * \return None.
+ */
+void rv2azelrates(double ro[3], double vo[3], double latgd, double lon, double alt, double jdut1, double razel[3], double razelrates[3]);
+
+/**
+ * \brief Range, azimuth and elevation from an ECEF position vector (see rv2azel).
+ *
+ * \param[in] recef is the satellite position vector in ECEF (km).
+ *
+ * \param[in] latgd is the site geodetic latitude (rad).
+ *
+ * \param[in] lon is the site longitude (rad).
+ *
+ * \param[in] alt is the site altitude (km).
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \return None.
+ */
+void ecef2azel(const double recef[3], double latgd, double lon, double alt, double razel[3]);
+
+/**
+ * \brief Computes the observer of a site.
+ *
+ * Holds the site vector and the rotation to SEZ, which rv2azel computes on every call.
+ *
+ * \param[in] latgd is the site geodetic latitude (rad).
+ *
+ * \param[in] lon is the site longitude (rad).
+ *
+ * \param[in] alt is the site altitude (km).
+ *
+ * \param[in,out] obs is the observer.
+ *
+ * \return None.
+ */
+void observerinit(double latgd, double lon, double alt, sgp4_observer_t *obs);
+
+/**
+ * \brief ecef2azel with the site of an observer.
+ *
+ * \param[in] recef is the satellite position vector in ECEF (km).
+ *
+ * \param[in] obs is the observer (see observerinit).
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \return None.
+ */
+void ecef2azel_observer(const double recef[3], const sgp4_observer_t *obs, double razel[3]);
+
+/**
+ * \brief rv2azel with the site of an observer and the rotation of a frame.
+ *
+ * \param[in] ro is the satellite position vector in TEME (km).
+ *
+ * \param[in] obs is the observer (see observerinit).
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit).
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \return None.
+ */
+void rv2azel_observer(const double ro[3], const sgp4_observer_t *obs, const sgp4_frame_t *frame, double razel[3]);
+
+/**
+ * \brief ecef2azel_observer with the range rate, azimuth rate and elevation rate.
+ *
+ * The range, azimuth and elevation are those of ecef2azel_observer, except at the zenith
+ * or nadir of the site, where the azimuth is the direction of motion instead of NAN and
+ * both angle rates are 0. The range rate is positive when the satellite moves away.
+ *
+ * \param[in] recef is the satellite position vector in ECEF (km).
+ *
+ * \param[in] vecef is the satellite velocity vector in ECEF (km/s) (see teme2ecefv).
+ *
+ * \param[in] obs is the observer (see observerinit).
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \param[in] razelrates is the range rate (km/s), azimuth rate (rad/s) and elevation rate (rad/s).
+ *
+ * \return None.
+ */
+void ecef2azelrates_observer(const double recef[3], const double vecef[3], const sgp4_observer_t *obs, double razel[3], double razelrates[3]);
+
+/**
+ * \brief rv2azelrates with the site of an observer and the rotation of a frame.
+ *
+ * \param[in] ro is the satellite position vector in TEME (km).
+ *
+ * \param[in] vo is the satellite velocity vector in TEME (km/s).
+ *
+ * \param[in] obs is the observer (see observerinit).
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit).
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \param[in] razelrates is the range rate (km/s), azimuth rate (rad/s) and elevation rate (rad/s).
+ *
+ * \return None.
+ */
+void rv2azelrates_observer(const double ro[3], const double vo[3], const sgp4_observer_t *obs, const sgp4_frame_t *frame, double razel[3], double razelrates[3]);
+
+/**
+ * \brief Sine of the elevation of a satellite.
+ *
+ * A dot product with the up vector of the site and a square root, without the range
+ * and azimuth. The sign and order of the elevations are those of ecef2azel, within
+ * rounding.
+ *
+ * \param[in] recef is the satellite position vector in ECEF (km).
+ *
+ * \param[in] obs is the observer (see observerinit).
+ *
+ * \return The sine of the elevation.
+ */
+double sinel_observer(const double recef[3], const sgp4_observer_t *obs);
+
 /**
  * \brief .
  *
@@ -155,6 +427,53 @@ void rot3(double invec[3], double xval, double outvec[3]);
  */
 void rot2(double invec[3], double xval, double outvec[3]);
 
+/**
+ * \brief Single precision teme2ecef (see sgp4f).
+ *
+ * \param[in] rteme is the position vector in TEME (km).
+ *
+ * \param[in] jdut1 is the julian date (days), kept in double.
+ *
+ * \param[in] recef is the position vector in ECEF (km).
+ *
+ * \return None.
+ */
+void teme2eceff(float rteme[3], double jdut1, float recef[3]);
+
+/**
+ * \brief Single precision site.
+ *
+ * \param[in] latgd is the site geodetic latitude (rad).
+ *
+ * \param[in] lon is the site longitude (rad).
+ *
+ * \param[in] alt is the site altitude (km).
+ *
+ * \param[in] rs is the site position vector in ECEF (km).
+ *
+ * \return None.
+ */
+void sitef(float latgd, float lon, float alt, float rs[3]);
+
+/**
+ * \brief Single precision rv2azel (see sgp4f).
+ *
+ * \param[in] ro is the satellite position vector in TEME (km).
+ *
+ * \param[in] latgd is the site geodetic latitude (rad).
+ *
+ * \param[in] lon is the site longitude (rad).
+ *
+ * \param[in] alt is the site altitude (km).
+ *
+ * \param[in] jdut1 is the julian date (days), kept in double.
+ *
+ * \param[in] razel is the range (km), azimuth (rad) and elevation (rad).
+ *
+ * \return None.
+ */
+void rv2azelf(float ro[3], float latgd, float lon, float alt, double jdut1, float razel[3]);
+
 /**
  * \brief .
  *
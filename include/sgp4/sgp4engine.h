@@ -0,0 +1,196 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Multithreaded propagation of a catalog to one time or a sequence of times.
+ *
+ * The engine keeps a pool of POSIX threads and its own copy of the catalog. At load time
+ * the catalog is cut into one contiguous partition per thread, of about the same estimated
+ * cost, and each thread copies its partition and clears its part of the output buffers
+ * itself, so that with the first touch policy of the kernel (and pinned threads) that
+ * memory is placed on the NUMA node of the thread that uses it.
+ *
+ * On each run every thread cuts its partition into SGP4_ENGINE_CHUNKS chunks of about the
+ * same estimated cost and works through them; a thread that runs out of chunks steals the
+ * last chunk of another thread. The cost of a record is estimated from its kind, since deep
+ * space records cost more than near earth ones, and for resonant records from the number
+ * of integrator steps between the last time and the new one.
+ *
+ * Each record is propagated by sgp4() exactly once per time, and times run one after the
+ * other, so results are identical to calling sgp4() on each record serially with the same
+ * sequence of times.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4engine SGP4 Engine
+ * \{
+ */
+
+#ifndef SGP4ENGINE_H_
+#define SGP4ENGINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "sgp4unit.h"
+
+/**
+ * \brief Chunks each thread cuts its partition into on every run.
+ */
+#define SGP4_ENGINE_CHUNKS  16
+
+/**
+ * \brief Counters of the last run.
+ */
+typedef struct
+{
+    double seconds;     /* Wall clock time of the run (sec) */
+    size_t nok;         /* Records propagated without error */
+    size_t steals;      /* Chunks taken from the partition of another thread */
+} sgp4_enginestats_t;
+
+/**
+ * \brief Propagation engine.
+ *
+ * The fields are managed by the sgp4_engine functions; only out, satrecs, n and stats are
+ * meant to be read by the caller. The engine must not be moved while it is in use.
+ */
+typedef struct
+{
+    int nthreads;               /* Threads, including the calling one */
+    bool pin;                   /* Threads are pinned to processors */
+    gravconsttype whichconst;
+    elsetrec *satrecs;          /* Copy of the catalog, updated by sgp4() on each run */
+    size_t n;
+    sgp4_soa_t out;             /* Positions, velocities and error codes of the last run */
+    sgp4_enginestats_t stats;
+
+    /* Internal state */
+    const elsetrec *src;        /* Catalog being loaded */
+    double jd;                  /* Time of the run */
+    size_t *first;              /* First record of each partition, nthreads + 1 entries */
+    size_t *bounds;             /* First record of each chunk, SGP4_ENGINE_CHUNKS + 1 per thread */
+    void *workers;              /* Chunks left and counters of each thread */
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t start, done;
+    unsigned long generation;   /* Incremented for each job */
+    int job, running;
+} sgp4_engine_t;
+
+/**
+ * \brief Function called after each time of sgp4_engine_sequence.
+ *
+ * \param[in] arg is the argument given to sgp4_engine_sequence.
+ *
+ * \param[in] k is the index of the time.
+ *
+ * \param[in] jd is the julian date.
+ *
+ * \param[in] out holds the positions, velocities and error codes of every record.
+ */
+typedef void (*sgp4_engine_step_t)(void *arg, size_t k, double jd, const sgp4_soa_t *out);
+
+/**
+ * \brief Starts the threads of an engine.
+ *
+ * \param[in,out] eng is the engine, to be released with sgp4_engine_free.
+ *
+ * \param[in] nthreads is the number of threads, including the calling one, or 0 for one per
+ * online processor.
+ *
+ * \param[in] pin pins each thread to one processor (Linux only).
+ *
+ * \return TRUE/FALSE if the engine was started or not.
+ */
+bool sgp4_engine_init(sgp4_engine_t *eng, int nthreads, bool pin);
+
+/**
+ * \brief Stops the threads and releases the catalog and buffers of an engine.
+ *
+ * \param[in,out] eng is the engine.
+ *
+ * \return None.
+ */
+void sgp4_engine_free(sgp4_engine_t *eng);
+
+/**
+ * \brief Copies a catalog into the engine, replacing the previous one.
+ *
+ * \param[in,out] eng is the engine.
+ *
+ * \param[in] whichconst is the set of gravity constants of the records.
+ *
+ * \param[in] satrecs is the array of initialized records.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \return TRUE/FALSE if the catalog was loaded or memory ran out.
+ */
+bool sgp4_engine_load(sgp4_engine_t *eng, gravconsttype whichconst, const elsetrec satrecs[], size_t n);
+
+/**
+ * \brief Propagates the catalog to a julian date.
+ *
+ * Results are left in eng->out. Records that fail with error codes 1 to 4 get NAN positions
+ * and velocities, as in sgp4_batch.
+ *
+ * \param[in,out] eng is the engine.
+ *
+ * \param[in] jd is the julian date.
+ *
+ * \return The number of records propagated without error.
+ */
+size_t sgp4_engine_run(sgp4_engine_t *eng, double jd);
+
+/**
+ * \brief Propagates the catalog to a sequence of julian dates.
+ *
+ * \param[in,out] eng is the engine.
+ *
+ * \param[in] jds is the array of julian dates.
+ *
+ * \param[in] ntimes is the number of julian dates.
+ *
+ * \param[in] step is called after each date with the results. It can be NULL.
+ *
+ * \param[in] arg is passed to step.
+ *
+ * \return The number of records propagated without error, summed over the dates.
+ */
+size_t sgp4_engine_sequence(sgp4_engine_t *eng, const double jds[], size_t ntimes, sgp4_engine_step_t step,
+                            void *arg);
+
+#endif /* SGP4ENGINE_H_ */
+
+/** \} End of sgp4engine group */
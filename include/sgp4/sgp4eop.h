@@ -0,0 +1,203 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Earth orientation parameters from IERS data.
+ *
+ * Polar motion (xp, yp) and UT1-UTC from the IERS finals files (finals.all, finals.data,
+ * finals2000A.all or finals2000A.data, Bulletin A columns, including the predictions), read
+ * from local files only. The values are kept as a table of one entry per day from the
+ * first date of the file, so a lookup is an index and a linear interpolation. Across a
+ * leap second the UT1-UTC of the day before is interpolated towards the value without it.
+ *
+ * The table can be saved as a binary file, a 64 byte header followed by the entries:
+ *
+ * - magic "SGPE", format version, and an endian tag and entry size of the writer;
+ * - the modified julian date of the first entry and the number of entries.
+ *
+ * sgp4_eop_open maps the file read only and shared, so processes using the same file share
+ * its pages. A table installed with sgp4_eop_use replaces the built-in polar motion model of
+ * polarm, and its UT1-UTC is added to the date of the sidereal time in teme2ecef, rv2azel
+ * and the frames (see frameinit) within the dates of the table. Outside them, or without a
+ * table, the results are as before.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4eop SGP4 EOP
+ * \{
+ */
+
+#ifndef SGP4EOP_H_
+#define SGP4EOP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * \brief Result of loading or opening a table.
+ */
+typedef enum
+{
+    eop_ok,         /* Table loaded */
+    eop_eio,        /* File missing or unreadable */
+    eop_eformat,    /* No entries, dates not consecutive, or binary file of another version, byte order or layout */
+    eop_enomem      /* Out of memory */
+} sgp4eopstatus;
+
+/**
+ * \brief Values of one day, at 0h UTC.
+ */
+typedef struct
+{
+    int32_t xp;     /* Polar motion x (1e-6 arcsec) */
+    int32_t yp;     /* Polar motion y (1e-6 arcsec) */
+    int32_t dut1;   /* UT1-UTC (1e-7 sec) */
+} sgp4_eop_entry_t;
+
+/**
+ * \brief Binary file header, followed by count entries.
+ */
+typedef struct
+{
+    char magic[4];          /* "SGPE" */
+    uint32_t version;       /* Format version */
+    uint32_t endian;        /* 0x01020304 in the byte order of the writer */
+    uint32_t entsize;       /* sizeof(sgp4_eop_entry_t) of the writer */
+    int32_t mjd0;           /* Modified julian date of the first entry */
+    uint32_t count;         /* Number of entries */
+    uint8_t reserved[40];   /* Zero, pads the header to 64 bytes */
+} sgp4_eop_header_t;
+
+/**
+ * \brief Table of earth orientation parameters.
+ */
+typedef struct
+{
+    const sgp4_eop_entry_t *entries;    /* One entry per day */
+    int32_t mjd0;                       /* Modified julian date of the first entry */
+    size_t n;                           /* Number of entries */
+    void *buf;                          /* Entries allocated by sgp4_eop_load */
+    void *map;                          /* Start of the mapping of sgp4_eop_open */
+    size_t maplen;                      /* Length of the mapping */
+} sgp4_eop_t;
+
+/**
+ * \brief Reads an IERS finals file.
+ *
+ * Reading stops at the first line without polar motion or UT1-UTC, after the predictions.
+ *
+ * \param[in] path is the finals file.
+ *
+ * \param[in,out] eop is the table, to be released with sgp4_eop_close. It is cleared when the
+ * result is not eop_ok.
+ *
+ * \return The status of the file (see sgp4eopstatus).
+ */
+sgp4eopstatus sgp4_eop_load(const char *path, sgp4_eop_t *eop);
+
+/**
+ * \brief Writes a table as a binary file.
+ *
+ * The file is written under a unique temporary name in the same directory, synced to disk
+ * and renamed, so readers never map a partial table, even after a crash or with several
+ * processes saving the same path. The file is created with mode 0644.
+ *
+ * \param[in] path is the binary file.
+ *
+ * \param[in] eop is the table.
+ *
+ * \return TRUE/FALSE if the file was written or not.
+ */
+bool sgp4_eop_save(const char *path, const sgp4_eop_t *eop);
+
+/**
+ * \brief Maps a binary file written by sgp4_eop_save.
+ *
+ * \param[in] path is the binary file.
+ *
+ * \param[in,out] eop is the table, to be released with sgp4_eop_close. It is cleared when the
+ * result is not eop_ok.
+ *
+ * \return The status of the file (see sgp4eopstatus).
+ */
+sgp4eopstatus sgp4_eop_open(const char *path, sgp4_eop_t *eop);
+
+/**
+ * \brief Releases a table.
+ *
+ * \param[in,out] eop is the table to release. It must not be the one in use.
+ *
+ * \return None.
+ */
+void sgp4_eop_close(sgp4_eop_t *eop);
+
+/**
+ * \brief Interpolates the parameters at a date.
+ *
+ * \param[in] eop is the table.
+ *
+ * \param[in] jd is the julian date (UTC) (days).
+ *
+ * \param[in,out] xp is the polar motion x (rad).
+ *
+ * \param[in,out] yp is the polar motion y (rad).
+ *
+ * \param[in,out] dut1 is UT1-UTC (sec).
+ *
+ * \return TRUE/FALSE if the date is within the table or not, the outputs are unchanged
+ * when not.
+ */
+bool sgp4_eop_get(const sgp4_eop_t *eop, double jd, double *xp, double *yp, double *dut1);
+
+/**
+ * \brief Installs the table used by the coordinate transformations (see sgp4coord).
+ *
+ * The table is not copied and must stay loaded while in use. The setting is global to the
+ * process, and must not be changed while other threads transform coordinates.
+ *
+ * \param[in] eop is the table, or NULL to return to the built-in polar motion model and a
+ * UT1-UTC of 0.
+ *
+ * \return None.
+ */
+void sgp4_eop_use(const sgp4_eop_t *eop);
+
+/**
+ * \brief Table installed by sgp4_eop_use.
+ *
+ * \return The table, or NULL.
+ */
+const sgp4_eop_t *sgp4_eop_current(void);
+
+#endif /* SGP4EOP_H_ */
+
+/** \} End of sgp4eop group */
@@ -0,0 +1,169 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Single precision (float) propagation.
+ *
+ * The record is initialised in double precision by sgp4init and then narrowed to float, so
+ * only the propagation itself runs in single precision. Deep space records (dpper and the
+ * resonance integrator in dspace) are supported.
+ *
+ * Largest position error against sgp4() (km), as measured by examples/sgp4_float_report.c on
+ * the Vallado test records (wgs72, opsmode 'i'):
+ *
+ * \verbatim
+ *   time since epoch    near earth (3 LEO)    deep space (Molniya, 2 GEO)
+ *   0 to 1 hour         0.010 - 0.016         0.04 - 0.10
+ *   1 to 24 hours       0.09  - 0.14          0.07 - 0.24
+ *   1 to 7 days         0.86  - 1.01          0.28 - 1.12
+ *   7 to 30 days        3.9   - 4.6           1.1  - 17.8
+ * \endverbatim
+ *
+ * Look angles from a mid latitude site are within 0.007 deg for the first day and 0.4 deg up
+ * to 30 days. The error grows with time since epoch, because the secular angles (mean
+ * anomaly plus mean motion times t, and the resonance integrator for deep space) lose
+ * resolution in float. Float is fine for display and coarse screening within a few days of
+ * epoch, but not for conjunction work or long spans.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4float SGP4 Float
+ * \{
+ */
+
+#ifndef SGP4FLOAT_H_
+#define SGP4FLOAT_H_
+
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+
+/**
+ * \brief Single precision copy of the elsetrec fields used by the propagation.
+ *
+ * The julian date of the epoch stays in double, since a float julian date only resolves a
+ * quarter of a day.
+ */
+typedef struct elsetrecf
+{
+    long int satnum;
+    int error;
+    char operationmode;
+    char method;
+
+    /* Near Earth */
+    int isimp;
+    float aycof,    con41,  cc1,        cc4,    cc5,    d2,         d3,     d4,
+          delmo,    eta,    argpdot,    omgcof, sinmao, t,          t2cof,  t3cof,
+          t4cof,    t5cof,  x1mth2,     x7thm1, mdot,   nodedot,    xlcof,  xmcof,
+          nodecf;
+
+    /* Deep Space */
+    int irez;
+    float d2201,    d2211,  d3210,  d3222,  d4410,  d4422,  d5220,  d5232,
+          d5421,    d5433,  dedt,   del1,   del2,   del3,   didt,   dmdt,
+          dnodt,    domdt,  e3,     ee2,    peo,    pgho,   pho,    pinco,
+          plo,      se2,    se3,    sgh2,   sgh3,   sgh4,   sh2,    sh3,
+          si2,      si3,    sl2,    sl3,    sl4,    gsto,   xfact,  xgh2,
+          xgh3,     xgh4,   xh2,    xh3,    xi2,    xi3,    xl2,    xl3,
+          xl4,      xlamo,  zmol,   zmos,   atime,  xli,    xni;
+
+    double jdsatepoch;
+    float bstar,    inclo,  nodeo,  ecco,   argpo,  mo,     no;
+} elsetrecf;
+
+/**
+ * \brief Narrows an initialised record to single precision.
+ *
+ * \param[in] satrec is the record initialised by sgp4init or twoline2rv.
+ *
+ * \param[in,out] satrecf is the single precision record.
+ *
+ * \return None.
+ */
+void elsetrec2f(const elsetrec *satrec, elsetrecf *satrecf);
+
+/**
+ * \brief Initialises a single precision record.
+ *
+ * Runs sgp4init in double precision and narrows the result. The parameters are the same as
+ * in sgp4init.
+ *
+ * \param[in] whichconst is the set of gravity constants (wgs72old, wgs72 or wgs84).
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in] satn is the satellite number.
+ *
+ * \param[in] epoch is the epoch time in days from jan 0, 1950. 0 hr.
+ *
+ * \param[in] xbstar is the sgp4 type drag coefficient (kg/m2er).
+ *
+ * \param[in] xecco is the eccentricity.
+ *
+ * \param[in] xargpo is the argument of perigee (rad).
+ *
+ * \param[in] xinclo is the inclination (rad).
+ *
+ * \param[in] xmo is the mean anomaly (rad).
+ *
+ * \param[in] xno is the mean motion (rad/min).
+ *
+ * \param[in] xnodeo is the right ascension of the ascending node (rad).
+ *
+ * \param[in,out] satrec is the single precision record.
+ *
+ * \return TRUE/FALSE if the record was initialised or not (see satrec->error).
+ */
+bool sgp4initf(gravconsttype whichconst, char opsmode, const int satn, const double epoch, const double xbstar,
+               const double xecco, const double xargpo, const double xinclo, const double xmo, const double xno,
+               const double xnodeo, elsetrecf *satrec);
+
+/**
+ * \brief Single precision sgp4.
+ *
+ * \param[in] whichconst is the set of gravity constants used to initialise the record.
+ *
+ * \param[in,out] satrec is the single precision record.
+ *
+ * \param[in] tsince is the time since epoch (minutes).
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not (see satrec->error).
+ */
+bool sgp4f(gravconsttype whichconst, elsetrecf *satrec, float tsince, float r[3], float v[3]);
+
+#endif /* SGP4FLOAT_H_ */
+
+/** \} End of sgp4float group */
@@ -0,0 +1,130 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Pipelined ingest of a catalog: read, initialize and publish.
+ *
+ * The three passes of a catalog load overlap instead of running one after the other. A
+ * reader thread splits the catalog into entries (sgp4_reader_next), a pool of init threads
+ * decodes and initializes them (twoline_init, which runs sgp4init), and the calling thread
+ * publishes each record through a callback as soon as it is ready. The stages are linked
+ * by bounded lock-free queues; a stage that finds its output queue full waits, so a slow
+ * consumer holds back the reader instead of growing memory.
+ *
+ * Records reach the publisher in the order the init threads finish them, which is not the
+ * catalog order when there is more than one init thread; the index of each entry gives its
+ * position in the catalog.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4ingest SGP4 Ingest
+ * \{
+ */
+
+#ifndef SGP4INGEST_H_
+#define SGP4INGEST_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+#include "sgp4reader.h"
+
+/**
+ * \brief Default number of entries each queue can hold.
+ */
+#define SGP4_INGEST_DEPTH   256
+
+/**
+ * \brief Counters of one stage of the pipeline.
+ */
+typedef struct
+{
+    size_t count;       /* Entries passed on to the next stage */
+    size_t failed;      /* Entries with a status other than tle_ok (init stage) */
+    size_t stalls;      /* Waits on an empty input or full output queue */
+    double seconds;     /* Time from the start of the call to the last entry of the stage (sec) */
+} sgp4_stage_t;
+
+/**
+ * \brief Counters of the whole pipeline.
+ */
+typedef struct
+{
+    sgp4_stage_t read, init, publish;
+    int nthreads;       /* Init threads used */
+} sgp4_ingest_stats_t;
+
+/**
+ * \brief Callback receiving each record.
+ *
+ * \param[in] arg is the argument given to sgp4_ingest.
+ *
+ * \param[in] index is the position of the entry in the catalog, from 0.
+ *
+ * \param[in] entry is the entry, pointing into the text of the reader.
+ *
+ * \param[in] satrec is the record, initialized when entry->status is tle_ok. It is only
+ * valid during the call.
+ */
+typedef void (*sgp4_publish_t)(void *arg, size_t index, const sgp4_entry_t *entry, const elsetrec *satrec);
+
+/**
+ * \brief Reads, initializes and publishes every entry of a catalog.
+ *
+ * \param[in,out] rd is the reader of the catalog.
+ *
+ * \param[in] checksum enables the check of the checksum of both lines.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in] whichconst is the set of gravity constants.
+ *
+ * \param[in] nthreads is the number of init threads, or 0 for one per online processor.
+ *
+ * \param[in] depth is the capacity of each queue (rounded up to a power of two), or 0 for
+ * SGP4_INGEST_DEPTH.
+ *
+ * \param[in] publish is called by the calling thread for every entry, failed ones included.
+ *
+ * \param[in] arg is passed to publish.
+ *
+ * \param[in,out] stats receives the counters. It is refreshed before each call of publish,
+ * so the callback can follow the progress, and at the end. It can be NULL.
+ *
+ * \return The number of records initialized without error.
+ */
+size_t sgp4_ingest(sgp4_reader_t *rd, bool checksum, char opsmode, gravconsttype whichconst, int nthreads,
+                   size_t depth, sgp4_publish_t publish, void *arg, sgp4_ingest_stats_t *stats);
+
+#endif /* SGP4INGEST_H_ */
+
+/** \} End of sgp4ingest group */
@@ -53,6 +53,17 @@
 #include "sgp4ext.h"    /* For several misc routines */
 #include "sgp4unit.h"   /* For sgp4init and getgravconst */
 
+/**
+ * \brief Result of twoline_parse and twoline_init.
+ */
+typedef enum
+{
+    tle_ok,         /* Element set decoded (and initialized) */
+    tle_eformat,    /* Lines shorter than 69 columns, wrong line numbers, different catalog numbers or bad fields */
+    tle_echecksum,  /* Checksum of a line does not match */
+    tle_einit       /* sgp4init failed, the error code is in satrec->error */
+} tlestatus;
+
 /**
  * \brief .
  *
@@ -81,6 +92,61 @@ void twoline2rv(char longstr1[130], char longstr2[130], char opsmode, gravconstt
  */
 bool twoline_checksum(const char longstr[]);
 
+/**
+ * \brief Decodes a two line element set without modifying it.
+ *
+ * The lines can be const and need not be null terminated. The fixed columns are decoded
+ * in place, without copies or libc conversions, and the epoch julian date is built
+ * directly from the year and day of year. Catalog numbers can be in the Alpha-5 form (a
+ * letter for the two leading digits, A = 10 to Z = 33 without I and O).
+ *
+ * The result is the same as twoline2rv, jdsatepoch included, except for the mean motion,
+ * which is read with all 11 columns (twoline2rv drops its last 2 digits). sgp4init is not
+ * called, see twoline_init.
+ *
+ * \param[in] line1 is the first line.
+ *
+ * \param[in] len1 is the length of the first line, at least 69.
+ *
+ * \param[in] line2 is the second line.
+ *
+ * \param[in] len2 is the length of the second line, at least 69.
+ *
+ * \param[in] checksum enables the check of the checksum of both lines.
+ *
+ * \param[in] whichconst is the set of gravity constants (for the semi-major axis).
+ *
+ * \param[in,out] satrec receives the catalog number, epoch and mean elements in sgp4 units.
+ *
+ * \return tle_ok, tle_eformat or tle_echecksum.
+ */
+tlestatus twoline_parse(const char *line1, size_t len1, const char *line2, size_t len2, bool checksum,
+                        gravconsttype whichconst, elsetrec *satrec);
+
+/**
+ * \brief Decodes a two line element set with twoline_parse and initializes the record.
+ *
+ * \param[in] line1 is the first line.
+ *
+ * \param[in] len1 is the length of the first line, at least 69.
+ *
+ * \param[in] line2 is the second line.
+ *
+ * \param[in] len2 is the length of the second line, at least 69.
+ *
+ * \param[in] checksum enables the check of the checksum of both lines.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in] whichconst is the set of gravity constants.
+ *
+ * \param[in,out] satrec is the record to initialize.
+ *
+ * \return tle_ok, tle_eformat, tle_echecksum or tle_einit.
+ */
+tlestatus twoline_init(const char *line1, size_t len1, const char *line2, size_t len2, bool checksum,
+                       char opsmode, gravconsttype whichconst, elsetrec *satrec);
+
 #endif /* SGP4IO_H_ */
 
 /** \} End of sgp4io group */
@@ -0,0 +1,151 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Look angles from a network of observers to a catalog.
+ *
+ * Range, azimuth and elevation from each of M observers to each of N satellites at one
+ * julian date. The TEME positions (as left by sgp4_batch or sgp4_engine_run) are rotated to
+ * ECEF once per satellite with the rotation of a frame, and each observer then uses its
+ * cached site vector and SEZ rotation (see observerinit). The observer loop runs over the
+ * satellites 2, 4 or 8 at a time with SSE2, AVX2 or AVX-512 as detected at runtime.
+ *
+ * Results follow ecef2azel_observer: azimuth from -pi to pi, NAN when the satellite is at
+ * the zenith or nadir of the site, and NAN everywhere for records that failed to propagate.
+ * The elevation is taken as an arc tangent of the up and horizontal components instead of
+ * an arc sine, and the SIMD lanes use the Cephes arc tangent, so angles agree with
+ * ecef2azel_observer to within 1e-13 rad (the arc sine loses digits near the zenith).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4look SGP4 Look Angles
+ * \{
+ */
+
+#ifndef SGP4LOOK_H_
+#define SGP4LOOK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+#include "sgp4coord.h"
+
+/**
+ * \brief Dense M x N output, the entry of observer i and satellite k at [i * n + k].
+ */
+typedef struct
+{
+    double *range;      /* Range (km) */
+    double *az;         /* Azimuth (rad) */
+    double *el;         /* Elevation (rad) */
+} sgp4_lookmat_t;
+
+/**
+ * \brief Sparse output entry.
+ */
+typedef struct
+{
+    uint32_t observer;  /* Index of the observer */
+    uint32_t satellite; /* Index of the satellite */
+    double range;       /* Range (km) */
+    double az;          /* Azimuth (rad) */
+    double el;          /* Elevation (rad) */
+} sgp4_lookentry_t;
+
+/**
+ * \brief Rotates an array of TEME positions to ECEF.
+ *
+ * Each position is rotated as by teme2ecef_frame.
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit or framerotation).
+ *
+ * \param[in] teme holds the TEME positions (x, y, z), the other buffers are not used.
+ *
+ * \param[in] n is the number of positions.
+ *
+ * \param[in,out] ecef receives the ECEF positions (x, y, z), the other buffers are not used.
+ *
+ * \return None.
+ */
+void sgp4_look_ecef(const sgp4_frame_t *frame, const sgp4_soa_t *teme, size_t n, sgp4_soa_t *ecef);
+
+/**
+ * \brief Range, azimuth and elevation from every observer to every satellite.
+ *
+ * \param[in] obs is the array of observers (see observerinit).
+ *
+ * \param[in] m is the number of observers.
+ *
+ * \param[in] frame is the frame of the julian date of the positions.
+ *
+ * \param[in] teme holds the TEME positions (x, y, z) of the satellites.
+ *
+ * \param[in] n is the number of satellites.
+ *
+ * \param[in,out] out receives m * n entries in each buffer.
+ *
+ * \return TRUE/FALSE if the matrix was computed or memory ran out.
+ */
+bool sgp4_look_matrix(const sgp4_observer_t obs[], size_t m, const sgp4_frame_t *frame, const sgp4_soa_t *teme,
+                      size_t n, sgp4_lookmat_t *out);
+
+/**
+ * \brief Observer and satellite pairs above an elevation mask.
+ *
+ * Entries are written by observer, then by satellite, in increasing order.
+ *
+ * \param[in] obs is the array of observers (see observerinit).
+ *
+ * \param[in] m is the number of observers.
+ *
+ * \param[in] frame is the frame of the julian date of the positions.
+ *
+ * \param[in] teme holds the TEME positions (x, y, z) of the satellites.
+ *
+ * \param[in] n is the number of satellites.
+ *
+ * \param[in] minel is the elevation mask (rad).
+ *
+ * \param[in,out] entries receives up to max entries.
+ *
+ * \param[in] max is the capacity of entries.
+ *
+ * \return The number of pairs at or above the mask, which can be larger than max, or
+ * (size_t)-1 if memory ran out.
+ */
+size_t sgp4_look_sparse(const sgp4_observer_t obs[], size_t m, const sgp4_frame_t *frame, const sgp4_soa_t *teme,
+                        size_t n, double minel, sgp4_lookentry_t entries[], size_t max);
+
+#endif /* SGP4LOOK_H_ */
+
+/** \} End of sgp4look group */
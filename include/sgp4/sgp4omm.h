@@ -0,0 +1,190 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Streaming readers of Orbit Mean-elements Messages (OMM).
+ *
+ * Reads catalogs published as CCSDS OMM in the CSV, JSON and KVN forms used by the
+ * public element set feeds, without going through two line element sets, so catalog
+ * numbers are not limited to five digits. Each field is decoded once, straight into the
+ * arguments of sgp4init. JSON is scanned token by token, without building a tree.
+ *
+ * Fields used (other fields are skipped):
+ *   NORAD_CAT_ID, EPOCH, MEAN_MOTION (rev/day), ECCENTRICITY, INCLINATION, RA_OF_ASC_NODE,
+ *   ARG_OF_PERICENTER, MEAN_ANOMALY (deg), BSTAR (1/earth radii), all required;
+ *   MEAN_MOTION_DOT (rev/day^2), MEAN_MOTION_DDOT (rev/day^3), OBJECT_NAME and OBJECT_ID,
+ *   optional.
+ *
+ * Layouts:
+ *   CSV:  a header line naming the columns, then one record per line. Fields can be
+ *         quoted with '"'.
+ *   JSON: an array of objects, or objects one after the other. Values can be numbers or
+ *         strings.
+ *   KVN:  "KEY = value" lines, with optional units in brackets. A record ends at the next
+ *         CCSDS_OMM_VERS line, at a key already seen in the record, or at the end of the file.
+ *
+ * Like sgp4_reader_next, every record gets its own status and line number, and a bad
+ * record never stops the reading.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4omm SGP4 OMM
+ * \{
+ */
+
+#ifndef SGP4OMM_H_
+#define SGP4OMM_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+#include "sgp4io.h"
+#include "sgp4reader.h"
+
+/**
+ * \brief Most columns of a CSV header.
+ */
+#define SGP4_OMM_COLUMNS    64
+
+/**
+ * \brief Form of the messages.
+ */
+typedef enum
+{
+    omm_csv,
+    omm_json,
+    omm_kvn
+} ommformat;
+
+/**
+ * \brief Messages being read.
+ */
+typedef struct
+{
+    sgp4_reader_t text;                 /* Text of the messages */
+    ommformat format;
+    signed char columns[SGP4_OMM_COLUMNS];  /* CSV: field of each column, -1 when not used */
+    int ncolumns;                       /* CSV: columns of the header, 0 before it is read, -1 if it is bad */
+} sgp4_omm_t;
+
+/**
+ * \brief One record of the messages, pointing into their text.
+ */
+typedef struct
+{
+    tlestatus status;       /* tle_ok, tle_eformat (bad or missing field) or tle_einit (sgp4init error) */
+    size_t lineno;          /* Line number where the record starts, from 1 */
+    const char *name;       /* OBJECT_NAME as written, without quotes (not null terminated), or NULL */
+    size_t namelen;
+    const char *id;         /* OBJECT_ID as written, without quotes (not null terminated), or NULL */
+    size_t idlen;
+} sgp4_ommentry_t;
+
+/**
+ * \brief Maps a file of messages for reading.
+ *
+ * \param[in] path is the file.
+ *
+ * \param[in] format is the form of the messages.
+ *
+ * \param[in,out] omm is the reader, to be released with sgp4_omm_close.
+ *
+ * \return TRUE/FALSE if the file was mapped or not.
+ */
+bool sgp4_omm_open(const char *path, ommformat format, sgp4_omm_t *omm);
+
+/**
+ * \brief Reads messages that are already in memory.
+ *
+ * \param[in] data is the text, which must stay valid while the reader is used.
+ *
+ * \param[in] size is the length of the text.
+ *
+ * \param[in] format is the form of the messages.
+ *
+ * \param[in,out] omm is the reader.
+ *
+ * \return None.
+ */
+void sgp4_omm_init(const char *data, size_t size, ommformat format, sgp4_omm_t *omm);
+
+/**
+ * \brief Unmaps the file of sgp4_omm_open.
+ *
+ * \param[in,out] omm is the reader to release.
+ *
+ * \return None.
+ */
+void sgp4_omm_close(sgp4_omm_t *omm);
+
+/**
+ * \brief Reads and initializes the next record.
+ *
+ * \param[in,out] omm is the reader.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in] whichconst is the set of gravity constants.
+ *
+ * \param[in,out] entry receives the position and status of the record.
+ *
+ * \param[in,out] satrec receives the record, initialized when entry->status is tle_ok. It
+ * can be NULL to only check the fields (status tle_ok or tle_eformat).
+ *
+ * \return TRUE/FALSE if a record was read or the end of the messages was reached.
+ */
+bool sgp4_omm_next(sgp4_omm_t *omm, char opsmode, gravconsttype whichconst, sgp4_ommentry_t *entry,
+                   elsetrec *satrec);
+
+/**
+ * \brief Reads up to max records into preallocated arrays.
+ *
+ * \param[in,out] omm is the reader.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in] whichconst is the set of gravity constants.
+ *
+ * \param[in,out] entries receives the entries, or can be NULL.
+ *
+ * \param[in,out] satrecs receives the records, or can be NULL.
+ *
+ * \param[in] max is the size of the arrays.
+ *
+ * \return The number of records read, failed ones included.
+ */
+size_t sgp4_omm_read(sgp4_omm_t *omm, char opsmode, gravconsttype whichconst, sgp4_ommentry_t entries[],
+                     elsetrec satrecs[], size_t max);
+
+#endif /* SGP4OMM_H_ */
+
+/** \} End of sgp4omm group */
@@ -103,6 +103,19 @@ typedef struct
     shadowtransit transit;
 } passinfo;
 
+/**
+ * \brief Sample of a doppler curve (see sgp4_dopplercurve).
+ */
+typedef struct
+{
+    double jd;          /* Julian date */
+    double az;          /* Azimuth (degrees) */
+    double el;          /* Elevation (degrees) */
+    double range;       /* Range (km) */
+    double rangerate;   /* Range rate (km/s), positive when moving away */
+    double doppler;     /* Offset of the received frequency from the carrier (Hz) */
+} dopplerpoint;
+
 /**
  * \brief .
  */
@@ -114,13 +127,11 @@ typedef struct
     double vo[3];
     double razel[3];
     double offset;      /* Min elevation for overpass prediction in radials */
+    double sinoffset;   /* Sine of offset */
     double sunoffset;   /* Min elevation sun for daylight in radials */
     double jdC;         /* Current used julian date */
     double jdCp;        /* Current used julian date for prediction */
 
-    double sgp4wrap( double jdCe);      /* returns the elevation for a given julian date */
-    double visiblewrap(double jdCe);    /* returns angle between sun surface and earth surface */
-
     char satName[25];   /* satellite name */
     char line1[80];     /* tle line 1 */
     char line2[80];     /* tle line 2 */
@@ -128,9 +139,23 @@ typedef struct
     double revpday;     /* revolutions per day */
     elsetrec satrec;
     double siteLat, siteLon, siteAlt, siteLatRad, siteLonRad;
+    sgp4_observer_t observer;   /* Site vector and rotation (see sgp4_site) */
     double satLat, satLon, satAlt, satAz, satEl, satDist,satJd;
+    double satRangeRate, satAzRate, satElRate;
     double sunAz, sunEl;
     int16_t satVis;
+    sgp4_frame_t frame;         /* Frame of the last sgp4_findsat */
+    double recef[3];            /* Satellite position vector of the last sgp4_findsat (ECEF) (km) */
+    double satro[3], satvo[3];  /* Satellite state of the last sgp4_findsat (TEME) (km, km/s), kept from later changes of ro and vo */
+    unsigned int pending;       /* Outputs of sgp4_findsat_lazy not computed yet */
+
+    bool tracking;      /* Tracking mode enabled (see sgp4_track) */
+    bool trackok;       /* Interpolation between the current anchors meets the tolerance */
+    bool trackokB;      /* sgp4 propagated the second anchor without error */
+    double tracktol;    /* Position tolerance of the tracking mode (km) */
+    double trackstep;   /* Nominal anchor spacing (days) */
+    double jdA, jdB;    /* Julian dates of the anchors */
+    double rA[3], vA[3], rB[3], vB[3];  /* Anchor states (km, km/s) */
 } sgp4_t;
 
 /**
@@ -168,6 +193,36 @@ void sgp4_site(sgp4_t *conf, double lat, double lon, double alt);
  */
 void sgp4_setsunrise(sgp4_t *conf, double degrees);
 
+/**
+ * \brief Enables the tracking mode of sgp4_findsat, or disables it with a tolerance of 0.
+ *
+ * In tracking mode the full sgp4 is only run at anchor times, and positions and velocities in
+ * between come from cubic Hermite interpolation of the anchor states. The anchor spacing is
+ * chosen from the orbit so that the position error stays within the tolerance, and each
+ * interval is checked against sgp4 once before use (the spacing is shortened where it fails).
+ * Within about 1 sec of a discontinuity of sgp4 itself (deep space integrator steps), and
+ * in intervals where sgp4 fails at an anchor or check point, the full sgp4 is used instead,
+ * so satrec.error is set by sgp4 at the query date. Queries moving forward in time cost
+ * about 2 sgp4 calls per interval; a jump backwards or beyond the next interval restarts
+ * from the new date.
+ *
+ * Measured on the Vallado test set over 3 days at 1 sec rate, with tolerances of 1 m to 1 km:
+ * the largest position error was 0.25 to 1.03 times the tolerance, with 1 to 6 sgp4 calls
+ * per 100 queries for near earth orbits and down to 0.06 for geosynchronous ones. The
+ * velocity error is up to about 0.01 km/s, mostly because the sgp4 velocity is not the exact
+ * derivative of its position. On very eccentric orbits a tolerance below 10 m gives short
+ * intervals near perigee, with little or no gain.
+ *
+ * The mode is reset by sgp4_init, and must be enabled again for new elements.
+ *
+ * \param[in,out] conf is the predictor initialised by sgp4_init.
+ *
+ * \param[in] tolerance is the allowed position error (km).
+ *
+ * \return None.
+ */
+void sgp4_track(sgp4_t *conf, double tolerance);
+
 /**
  * \brief Find satellite position from julian date.
  *
@@ -177,6 +232,120 @@ void sgp4_setsunrise(sgp4_t *conf, double degrees);
  */
 void sgp4_findsat(sgp4_t *conf, double jdI);
 
+/**
+ * \brief Find satellite position at the julian date of a frame.
+ *
+ * Same as sgp4_findsat, with the sidereal time, polar motion and sun vector taken from the
+ * frame, which can be shared by all the satellites evaluated at that date.
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit).
+ *
+ * \return None.
+ */
+void sgp4_findsat_frame(sgp4_t *conf, const sgp4_frame_t *frame);
+
+/**
+ * \brief Find satellite position from julian date, computing the other outputs on first use.
+ *
+ * Sets ro, vo, razel, satAz, satEl, satDist and satJd like sgp4_findsat, from a single
+ * TEME to ECEF rotation and without the sun vector. The latitude, longitude and altitude
+ * are computed by the first of sgp4_getlat, sgp4_getlon and sgp4_getalt, the rates by the
+ * first of sgp4_getrangerate, sgp4_getazrate and sgp4_getelrate, and the sun and
+ * visibility by the first of sgp4_getvis, sgp4_getsunaz and sgp4_getsunel. They hold the
+ * same values as after sgp4_findsat, also when other functions (e.g. sgp4_nextpass)
+ * propagate conf in between.
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \param[in] jdI is the julian date.
+ *
+ * \return None.
+ */
+void sgp4_findsat_lazy(sgp4_t *conf, double jdI);
+
+/**
+ * \brief Latitude of the satellite (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The latitude (degrees).
+ */
+double sgp4_getlat(sgp4_t *conf);
+
+/**
+ * \brief Longitude of the satellite (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The longitude (degrees).
+ */
+double sgp4_getlon(sgp4_t *conf);
+
+/**
+ * \brief Altitude of the satellite (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The altitude (km).
+ */
+double sgp4_getalt(sgp4_t *conf);
+
+/**
+ * \brief Range rate of the satellite (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The range rate (km/s), positive when the satellite moves away.
+ */
+double sgp4_getrangerate(sgp4_t *conf);
+
+/**
+ * \brief Azimuth rate of the satellite (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The azimuth rate (degrees/s).
+ */
+double sgp4_getazrate(sgp4_t *conf);
+
+/**
+ * \brief Elevation rate of the satellite (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The elevation rate (degrees/s).
+ */
+double sgp4_getelrate(sgp4_t *conf);
+
+/**
+ * \brief Visibility of the satellite (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return -2 under the horizon, -1 in daylight, else 0 in umbra to 1000 fully lit.
+ */
+int16_t sgp4_getvis(sgp4_t *conf);
+
+/**
+ * \brief Azimuth of the sun (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The azimuth (degrees).
+ */
+double sgp4_getsunaz(sgp4_t *conf);
+
+/**
+ * \brief Elevation of the sun (see sgp4_findsat_lazy).
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \return The elevation (degrees).
+ */
+double sgp4_getsunel(sgp4_t *conf);
+
 /**
  * \brief Find satellite position from unix time.
  *
@@ -225,6 +394,32 @@ bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc
  */
 bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc, double minimumElevation);
 
+/**
+ * \brief Doppler curve of a pass, sampled at a fixed step from its start to its stop.
+ *
+ * Each sample takes one sgp4 call: the range rate comes from the sgp4 velocity rotated to
+ * ECEF (see rv2azelrates_observer) instead of differences of positions. The offset is
+ * -frequency * rangerate / c, to first order in rangerate / c. The tracking mode is not
+ * used, as its interpolated velocities are less accurate than those of sgp4. Samples where
+ * sgp4 reports an error (including decay) have NAN values, except for jd. Leaves ro and vo
+ * at the last sample.
+ *
+ * \param[in,out] conf is the predictor.
+ *
+ * \param[in] pass is the pass (see sgp4_nextpass).
+ *
+ * \param[in] step is the time between samples (seconds).
+ *
+ * \param[in] frequency is the carrier frequency (Hz).
+ *
+ * \param[in,out] curve receives up to max samples.
+ *
+ * \param[in] max is the capacity of curve.
+ *
+ * \return The number of samples of the pass, which can be larger than max.
+ */
+size_t sgp4_dopplercurve(sgp4_t *conf, const passinfo *pass, double step, double frequency, dopplerpoint curve[], size_t max);
+
 /**
  * \brief Initialize prediction algorithm, starting from a juliandate and predict passes aboven startelevation.
  *
@@ -265,6 +460,20 @@ int16_t sgp4_visible(sgp4_t *conf);
  */
 int16_t sgp4_visible(sgp4_t *conf, bool *notdark, double *deltaphi);
 
+/**
+ * \brief Elevation function of the overpass search (see brentmin and zbrent).
+ *
+ * Propagates to a julian date and returns sin(offset) - sin(elevation), which has the
+ * minimums and roots of offset - elevation. Only ro and vo are updated, not razel.
+ *
+ * \param[in,out] obj is the predictor (sgp4_t).
+ *
+ * \param[in] jdCe is the julian date.
+ *
+ * \return sin(offset) - sin(elevation).
+ */
+double sgp4_sgp4wrap(void *obj, double jdCe);
+
 /**
  * \brief .
  *
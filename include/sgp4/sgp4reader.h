@@ -0,0 +1,183 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Streaming reader of two and three line element set catalogs.
+ *
+ * A catalog file is mapped with mmap and read in one pass. Line ends are found 16 bytes at
+ * a time with SSE2 (memchr elsewhere), and each element set is decoded in place with
+ * twoline_parse, so no line is ever copied. Entries can be taken one at a time with
+ * sgp4_reader_next or into preallocated arrays with sgp4_reader_read.
+ *
+ * Accepted layout: any mix of 2LE entries (lines 1 and 2) and 3LE entries (a name line,
+ * optionally starting with "0 ", then lines 1 and 2), with LF or CRLF line ends and blank
+ * lines anywhere. A line 1 without a line 2, or a line 2 without a line 1, gives an entry
+ * with status tle_eformat and the reader goes on with the next line, so one corrupt entry
+ * never hides the following ones.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4reader SGP4 Reader
+ * \{
+ */
+
+#ifndef SGP4READER_H_
+#define SGP4READER_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+#include "sgp4io.h"
+
+/**
+ * \brief Catalog being read.
+ */
+typedef struct
+{
+    const char *data;       /* Catalog text */
+    size_t size;            /* Length of the text */
+    size_t pos;             /* Offset of the next line */
+    size_t lineno;          /* Number of the next line, from 1 */
+    void *map;              /* Mapping of sgp4_reader_open, NULL for sgp4_reader_init */
+    size_t maplen;
+} sgp4_reader_t;
+
+/**
+ * \brief One entry of a catalog, pointing into the catalog text.
+ */
+typedef struct
+{
+    tlestatus status;       /* Result of decoding the entry */
+    size_t lineno;          /* Line number of the first line of the entry, from 1 */
+    const char *name;       /* Name of a 3LE entry, without "0 " and line end (not null terminated), or NULL */
+    size_t namelen;
+    const char *line1;      /* First line without line end (not null terminated), or NULL */
+    size_t len1;
+    const char *line2;      /* Second line without line end (not null terminated), or NULL */
+    size_t len2;
+} sgp4_entry_t;
+
+/**
+ * \brief Maps a catalog file for reading.
+ *
+ * \param[in] path is the catalog file.
+ *
+ * \param[in,out] rd is the reader, to be released with sgp4_reader_close.
+ *
+ * \return TRUE/FALSE if the file was mapped or not.
+ */
+bool sgp4_reader_open(const char *path, sgp4_reader_t *rd);
+
+/**
+ * \brief Reads a catalog that is already in memory.
+ *
+ * \param[in] data is the catalog text, which must stay valid while the reader is used.
+ *
+ * \param[in] size is the length of the text.
+ *
+ * \param[in,out] rd is the reader.
+ *
+ * \return None.
+ */
+void sgp4_reader_init(const char *data, size_t size, sgp4_reader_t *rd);
+
+/**
+ * \brief Unmaps the catalog of sgp4_reader_open.
+ *
+ * \param[in,out] rd is the reader to release.
+ *
+ * \return None.
+ */
+void sgp4_reader_close(sgp4_reader_t *rd);
+
+/**
+ * \brief Takes the next line of the catalog.
+ *
+ * Lets other text formats share the mapping and the line search of the reader. The
+ * number of the line is rd->lineno - 1 after the call.
+ *
+ * \param[in,out] rd is the reader.
+ *
+ * \param[in,out] line receives the line, without line end (not null terminated).
+ *
+ * \param[in,out] len receives the length of the line.
+ *
+ * \return TRUE/FALSE if a line was taken or the end of the catalog was reached.
+ */
+bool sgp4_reader_line(sgp4_reader_t *rd, const char **line, size_t *len);
+
+/**
+ * \brief Reads and decodes the next entry.
+ *
+ * \param[in,out] rd is the reader.
+ *
+ * \param[in] checksum enables the check of the checksum of both lines.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in] whichconst is the set of gravity constants.
+ *
+ * \param[in,out] entry receives the position and status of the entry.
+ *
+ * \param[in,out] satrec receives the record, initialized when entry->status is tle_ok. It
+ * can be NULL to only split the catalog into entries (status tle_ok or tle_eformat).
+ *
+ * \return TRUE/FALSE if an entry was read or the end of the catalog was reached.
+ */
+bool sgp4_reader_next(sgp4_reader_t *rd, bool checksum, char opsmode, gravconsttype whichconst,
+                      sgp4_entry_t *entry, elsetrec *satrec);
+
+/**
+ * \brief Reads up to max entries into preallocated arrays.
+ *
+ * \param[in,out] rd is the reader.
+ *
+ * \param[in] checksum enables the check of the checksum of both lines.
+ *
+ * \param[in] opsmode is the mode of operation, afspc ('a') or improved ('i').
+ *
+ * \param[in] whichconst is the set of gravity constants.
+ *
+ * \param[in,out] entries receives the entries, or can be NULL.
+ *
+ * \param[in,out] satrecs receives the records of the entries, or can be NULL.
+ *
+ * \param[in] max is the size of the arrays.
+ *
+ * \return The number of entries read, failed ones included.
+ */
+size_t sgp4_reader_read(sgp4_reader_t *rd, bool checksum, char opsmode, gravconsttype whichconst,
+                        sgp4_entry_t entries[], elsetrec satrecs[], size_t max);
+
+#endif /* SGP4READER_H_ */
+
+/** \} End of sgp4reader group */
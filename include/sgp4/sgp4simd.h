@@ -0,0 +1,141 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief SIMD propagation of near earth satellites.
+ *
+ * The near earth path of sgp4 (method 'n') is evaluated for 2, 4 or 8 satellites at once,
+ * one satellite per lane, using SSE2, AVX2 or AVX-512 as detected at runtime. The isimp
+ * branch, the kepler iteration and the error exits (codes 1, 2, 4 and 6) are handled with
+ * lane masks. Deep space records in the same catalog are propagated with the scalar sgp4.
+ *
+ * Tolerance: the kernels use sqrt instead of pow and Cephes sine, cosine and arc tangent
+ * polynomials instead of libm. Built with -ffp-contract=off, as in CMakeLists.txt, they agree
+ * with sgp4() to within 1e-10 km in position and 1e-13 km/s in velocity from -3 to 30 days
+ * around epoch, with identical error codes. If the compiler is allowed to contract into FMA
+ * instructions, the cancellation in the drag terms moves positions by up to about 1e-6 km.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4simd SGP4 SIMD
+ * \{
+ */
+
+#ifndef SGP4SIMD_H_
+#define SGP4SIMD_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+
+/**
+ * \brief Instruction sets of the SIMD kernels.
+ */
+typedef enum
+{
+    simd_scalar,    /* sgp4() on every record */
+    simd_sse2,      /* 2 lanes */
+    simd_avx2,      /* 4 lanes */
+    simd_avx512     /* 8 lanes */
+} sgp4simdtype;
+
+/**
+ * \brief Catalog packed for the SIMD kernels.
+ */
+typedef struct
+{
+    gravconsttype whichconst;
+    sgp4simdtype isa;       /* Instruction set used, can be lowered after sgp4_pack_init */
+    elsetrec *satrecs;      /* Source records, used for deep space and by the scalar path */
+    size_t n;               /* Number of source records */
+    size_t nnear;           /* Number of near earth records packed in lanes */
+    size_t ndeep;           /* Number of records propagated with sgp4() */
+    size_t stride;          /* nnear rounded up to a multiple of 8 lanes */
+    size_t *nearidx;        /* Source index of each packed record */
+    size_t *deepidx;        /* Source index of each deep space record */
+    double *data;           /* Near earth fields, one array of stride values per field */
+    double radiusearthkm, xke, j2, vkmpersec;
+} sgp4_pack_t;
+
+/**
+ * \brief Detects the widest instruction set supported by the running CPU.
+ *
+ * \return The detected instruction set.
+ */
+sgp4simdtype sgp4_simd_detect(void);
+
+/**
+ * \brief Packs an array of initialized records for the SIMD kernels.
+ *
+ * The fields read by the near earth path are copied to a structure of arrays. The records
+ * are referenced, not copied, so the array must outlive the pack.
+ *
+ * \param[in,out] pack is the pack to initialize.
+ *
+ * \param[in] whichconst is the gravity model used to initialize the records.
+ *
+ * \param[in] satrecs is the array of records initialized by sgp4init or twoline2rv.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \return TRUE/FALSE if the pack was allocated or not.
+ */
+bool sgp4_pack_init(sgp4_pack_t *pack, gravconsttype whichconst, elsetrec satrecs[], size_t n);
+
+/**
+ * \brief Frees the memory of a pack.
+ *
+ * \param[in,out] pack is the pack to free.
+ *
+ * \return None.
+ */
+void sgp4_pack_free(sgp4_pack_t *pack);
+
+/**
+ * \brief Propagates every record of a pack to the same julian date.
+ *
+ * The output is indexed like the source array, as with sgp4_batch. Near earth records are
+ * not modified by the SIMD kernels, so their t and error fields are not updated.
+ *
+ * \param[in] pack is the packed catalog.
+ *
+ * \param[in] jd is the julian date to propagate to.
+ *
+ * \param[in,out] out is the structure-of-arrays output.
+ *
+ * \return The number of records propagated without error.
+ */
+size_t sgp4_pack_propagate(sgp4_pack_t *pack, double jd, sgp4_soa_t *out);
+
+#endif /* SGP4SIMD_H_ */
+
+/** \} End of sgp4simd group */
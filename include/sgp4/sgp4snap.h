@@ -0,0 +1,172 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Binary snapshots of initialised catalogs.
+ *
+ * A snapshot stores an array of records initialised by twoline2rv or sgp4init, so a process
+ * restart can skip parsing and sgp4init when the element sets have not changed. The file is
+ * a 64 byte header followed by the records as they are in memory:
+ *
+ * - magic "SGPS", format version, and an endian tag and record size of the writer;
+ * - the gravity model and opsmode used to initialise the records;
+ * - the number of records and an FNV-1a hash of the source element set lines.
+ *
+ * sgp4_snap_open maps the file with mmap and checks the header only, so loading costs no
+ * work per record. The mapping is private: sgp4() can update the records in place, and the
+ * pages it touches are copied on write, while sgp4_r leaves them shared. A snapshot written
+ * with a different byte order, record layout or version is rejected and must be rebuilt.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \defgroup sgp4snap SGP4 Snapshot
+ * \{
+ */
+
+#ifndef SGP4SNAP_H_
+#define SGP4SNAP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sgp4unit.h"
+
+/**
+ * \brief Result of opening a snapshot.
+ */
+typedef enum
+{
+    snap_ok,        /* Snapshot mapped */
+    snap_eio,       /* File missing or unreadable */
+    snap_eformat,   /* Not a snapshot, truncated, or written with another version, byte order or record layout */
+    snap_estale     /* Written from other element sets, gravity model or opsmode */
+} sgp4snapstatus;
+
+/**
+ * \brief File header, followed by count records.
+ */
+typedef struct
+{
+    char magic[4];          /* "SGPS" */
+    uint32_t version;       /* Format version, increased whenever elsetrec changes */
+    uint32_t endian;        /* 0x01020304 in the byte order of the writer */
+    uint32_t recsize;       /* sizeof(elsetrec) of the writer */
+    int32_t whichconst;
+    int32_t opsmode;
+    uint64_t count;         /* Number of records */
+    uint64_t hash;          /* sgp4_snap_hash of the source element set lines */
+    uint8_t reserved[24];   /* Zero, pads the header to 64 bytes */
+} sgp4_snap_header_t;
+
+/**
+ * \brief Snapshot mapped by sgp4_snap_open.
+ */
+typedef struct
+{
+    elsetrec *satrecs;      /* Records, in the private mapping */
+    size_t n;               /* Number of records */
+    void *map;              /* Start of the mapping */
+    size_t maplen;          /* Length of the mapping */
+} sgp4_snap_t;
+
+/**
+ * \brief FNV-1a hash of element set lines.
+ *
+ * Each line is hashed up to its end or its first carriage return or line feed, followed by
+ * a zero byte. The lines must be hashed before twoline2rv or sgp4_bulk_init, which modify
+ * them.
+ *
+ * \param[in] line1 is the first line of each record.
+ *
+ * \param[in] line2 is the second line of each record.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \return The 64 bit hash.
+ */
+uint64_t sgp4_snap_hash(const char *const line1[], const char *const line2[], size_t n);
+
+/**
+ * \brief Writes a snapshot.
+ *
+ * The file is written under a unique temporary name in the same directory, synced to disk
+ * and renamed, so readers never map a partial snapshot, even after a crash or with several
+ * processes saving the same path. The file is created with mode 0644.
+ *
+ * \param[in] path is the snapshot file.
+ *
+ * \param[in] whichconst is the gravity model used to initialise the records.
+ *
+ * \param[in] opsmode is the opsmode used to initialise the records.
+ *
+ * \param[in] hash is the sgp4_snap_hash of the source lines.
+ *
+ * \param[in] satrecs is the array of initialised records.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \return TRUE/FALSE if the snapshot was written or not.
+ */
+bool sgp4_snap_save(const char *path, gravconsttype whichconst, char opsmode, uint64_t hash,
+                    const elsetrec satrecs[], size_t n);
+
+/**
+ * \brief Maps a snapshot, checking that it matches the current element sets.
+ *
+ * \param[in] path is the snapshot file.
+ *
+ * \param[in] whichconst is the gravity model expected.
+ *
+ * \param[in] opsmode is the opsmode expected.
+ *
+ * \param[in] hash is the sgp4_snap_hash of the current source lines.
+ *
+ * \param[in,out] snap is the mapped snapshot, to be released with sgp4_snap_close. It is
+ * cleared when the result is not snap_ok.
+ *
+ * \return The status of the snapshot (see sgp4snapstatus).
+ */
+sgp4snapstatus sgp4_snap_open(const char *path, gravconsttype whichconst, char opsmode, uint64_t hash,
+                              sgp4_snap_t *snap);
+
+/**
+ * \brief Unmaps a snapshot.
+ *
+ * \param[in,out] snap is the snapshot to release.
+ *
+ * \return None.
+ */
+void sgp4_snap_close(sgp4_snap_t *snap);
+
+#endif /* SGP4SNAP_H_ */
+
+/** \} End of sgp4snap group */
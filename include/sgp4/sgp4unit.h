@@ -51,6 +51,8 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stddef.h>
+#include <string.h>
 #include <stdbool.h>
 
 #define SGP4Version  "SGP4 Version 2011-12-30"
@@ -77,6 +79,7 @@ typedef struct elsetrec
     int error;
     char operationmode;
     char init, method;
+    int variant;    /* Specialised propagator chosen by sgp4init (see sgp4_fast) */
 
     /* Near Earth */
     int isimp;
@@ -100,6 +103,35 @@ typedef struct elsetrec
            no;
 } elsetrec;
 
+/**
+ * \brief Structure-of-arrays output of the batch propagation.
+ *
+ * Each pointer must hold at least as many elements as records propagated. The velocity
+ * buffers (vx, vy, vz) and the error buffer can be NULL when not needed.
+ */
+typedef struct
+{
+    double *x, *y, *z;      /* Position (km) */
+    double *vx, *vy, *vz;   /* Velocity (km/s) */
+    int *error;             /* sgp4 error code of each record, 0 when successful */
+} sgp4_soa_t;
+
+/**
+ * \brief Caller-owned state of the reentrant propagator (sgp4_r).
+ *
+ * Holds everything sgp4() writes back into elsetrec, so the record itself can stay const
+ * and be shared between threads. Each thread (or each independent sequence of calls)
+ * needs its own context.
+ */
+typedef struct
+{
+    double t;                   /* Time since epoch of the last call (minutes) */
+    int error;                  /* Error code of the last call, 0 when successful */
+    double atime, xli, xni;     /* Deep space resonance integrator state */
+    double aycof, xlcof, con41,
+           x1mth2, x7thm1;      /* Per-call scratch (recomputed for deep space records) */
+} sgp4_ctx_t;
+
 /**
  * \brief .
  *
@@ -148,6 +180,121 @@ bool sgp4init(gravconsttype whichconst, char opsmode, const int satn, const doub
  */
 bool sgp4(gravconsttype whichconst, elsetrec *satrec, double tsince, double r[3], double v[3]);
 
+/**
+ * \brief Resets a propagation context.
+ *
+ * The next sgp4_r call with this context restarts the resonance integrator from epoch.
+ *
+ * \param[in,out] ctx is the context to reset.
+ *
+ * \return None.
+ */
+void sgp4_ctx_init(sgp4_ctx_t *ctx);
+
+/**
+ * \brief Reentrant form of sgp4 that does not modify the record.
+ *
+ * Gives the same results as sgp4() called with the same sequence of times. The time, the
+ * error code and the resonance integrator state are kept in ctx instead of satrec.
+ *
+ * \param[in] whichconst is the set of gravity constants used to initialise the record.
+ *
+ * \param[in] satrec is the record initialised by sgp4init or twoline2rv.
+ *
+ * \param[in,out] ctx is a context reset by sgp4_ctx_init or previously used with satrec.
+ *
+ * \param[in] tsince is the time since epoch (minutes).
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not (see ctx->error).
+ */
+bool sgp4_r(gravconsttype whichconst, const elsetrec *satrec, sgp4_ctx_t *ctx, double tsince, double r[3], double v[3]);
+
+/**
+ * \brief Propagates a record with the specialised propagator chosen by sgp4init.
+ *
+ * There is one propagator per gravity model (wgs72old, wgs72, wgs84) and kind of record
+ * (near earth with isimp 0 or 1, deep space with opsmode 'a' or 'i'), with the constants
+ * folded in and no method branches. sgp4() calls it when whichconst matches the model
+ * the record was initialised with. Results are identical to the generic path.
+ *
+ * A record whose variant does not match its method, isimp and opsmode (e.g. a zeroed or
+ * hand-filled record not passed to sgp4init) is not propagated: the error code is set to 7.
+ * sgp4() and the batch functions only check that the variant is in range and uses the
+ * gravity model of the call, and use the generic path otherwise; a record whose method,
+ * isimp or opsmode is changed after sgp4init must set variant to -1 for them.
+ *
+ * \param[in,out] satrec is the record initialised by sgp4init or twoline2rv.
+ *
+ * \param[in] tsince is the time since epoch (minutes).
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not (see satrec->error).
+ */
+bool sgp4_fast(elsetrec *satrec, double tsince, double r[3], double v[3]);
+
+/**
+ * \brief Reentrant form of sgp4_fast (see sgp4_r).
+ *
+ * Sets ctx->error to 7 for a record sgp4_fast would not propagate.
+ *
+ * \param[in] satrec is the record initialised by sgp4init or twoline2rv.
+ *
+ * \param[in,out] ctx is a context reset by sgp4_ctx_init or previously used with satrec.
+ *
+ * \param[in] tsince is the time since epoch (minutes).
+ *
+ * \param[in] r is the position vector (km).
+ *
+ * \param[in] v is the velocity vector (km/s).
+ *
+ * \return TRUE/FALSE if the propagation was successful or not (see ctx->error).
+ */
+bool sgp4_fast_r(const elsetrec *satrec, sgp4_ctx_t *ctx, double tsince, double r[3], double v[3]);
+
+/**
+ * \brief Propagates an array of records to the same julian date.
+ *
+ * The gravity constants are resolved once for the whole batch. Records that fail with
+ * error codes 1 to 4 get NAN positions and velocities.
+ *
+ * \param[in] whichconst is the gravity model used to initialize the records.
+ *
+ * \param[in,out] satrecs is the array of initialized records.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \param[in] jd is the julian date to propagate to.
+ *
+ * \param[in,out] out is the structure-of-arrays output.
+ *
+ * \return The number of records propagated without error.
+ */
+size_t sgp4_batch(gravconsttype whichconst, elsetrec satrecs[], size_t n, double jd, sgp4_soa_t *out);
+
+/**
+ * \brief Propagates an array of records, each one to its own time since epoch.
+ *
+ * \param[in] whichconst is the gravity model used to initialize the records.
+ *
+ * \param[in,out] satrecs is the array of initialized records.
+ *
+ * \param[in] n is the number of records.
+ *
+ * \param[in] tsince is the time since epoch of each record (minutes).
+ *
+ * \param[in,out] out is the structure-of-arrays output.
+ *
+ * \return The number of records propagated without error.
+ */
+size_t sgp4_batch_tsince(gravconsttype whichconst, elsetrec satrecs[], size_t n, const double tsince[], sgp4_soa_t *out);
+
 /**
  * \brief .
  *
@@ -54,22 +54,39 @@
 #include "sgp4pred.h"
 
 /**
- * \brief Calculates the sun coordinates.
+ * \brief Shadow function of the overpass search (see zbrent).
  *
- * This function calculates the geocentric equatorial position vector
- * the sun given the julian date. This is the low precision formula and
- * is valid for years from 1950 to 2050. Accuaracy of apparent coordinates
- * is 0.01 degrees. Notice many of the calculations are performed in
- * degrees, and are not changed until later. This is due to the fact that
- * the almanac uses degrees exclusively in their formulations.
+ * Propagates to a julian date (see sgp4_sgp4wrap) and returns the angle between the sun
+ * and earth limbs seen from the satellite, which is zero on entering or leaving the
+ * penumbra.
  *
- * \param[in] jd .
+ * \param[in,out] obj is the predictor (sgp4_t).
  *
- * \param[in] rsun .
+ * \param[in] jdCe is the julian date.
  *
- * \return None.
+ * \return The angle between the sun and earth limbs (rad).
  */
-void sun(double jd, double rsun[3]);
+double sgp4_visiblewrap(void *obj, double jdCe);
+
+/**
+ * \brief Check if satellite is visible, with the sun vector and the rotation of a frame.
+ *
+ * Same as sgp4_visible for the julian date of the frame, which must be the one of the
+ * satellite position ro (see sgp4_findsat_frame).
+ *
+ * \param[in,out] conf is the predictor, its sunAz and sunEl are updated.
+ *
+ * \param[in] frame is the frame of the julian date (see frameinit).
+ *
+ * \param[in] ro is the satellite position vector in TEME (km).
+ *
+ * \param[in,out] notdark is set when the sun is above conf->sunoffset.
+ *
+ * \param[in,out] deltaphi is the angle between the sun and earth limbs seen from the satellite (rad).
+ *
+ * \return 0 in umbra to 1000 when fully lit.
+ */
+int16_t sgp4_visible_frame(sgp4_t *conf, const sgp4_frame_t *frame, const double ro[3], bool *notdark, double *deltaphi);
 
 #endif /* VISIBLE_H_ */
 
@@ -41,7 +41,6 @@
 #include <math.h>
 
 #include <sgp4/brent.h>
-#include <sgp4/sgp4pred.h>
 
 #define ITMAX   100         /* Here ITMAX is the maximum allowed number of iterations; */
 #define R       0.61803399
@@ -51,7 +50,7 @@
 #define SHFT2(a,b,c)    (a)=(b);(b)=(c);
 #define SHFT3(a,b,c,d)  (a)=(b);(b)=(c);(c)=(d);
 
-double brentmin(double ax, double bx, double cx, double (Sgp4::*f)(double), double tol, double *xmin, Sgp4* obj)
+double brentmin(double ax, double bx, double cx, brentfunc f, double tol, double *xmin, void *obj)
 {
     int iter;
     double a,b,d,etemp,fu,fv,fw,fx,p,q,r,tol1,tol2,u,v,w,x,xm;
@@ -60,7 +59,7 @@ double brentmin(double ax, double bx, double cx, double (Sgp4::*f)(double), doub
     a = (ax < cx ? ax : cx);    /* a and b must be in ascending order, */
     b = (ax > cx ? ax : cx);    /* but input abscissas need not be. */
     x = w = v = bx;             /* Initializations... */
-    fw = fv = fx = (obj->*f)(x);
+    fw = fv = fx = f(obj, x);
     for(iter = 1; iter <= ITMAX; iter++) /* Main program loop */
     {
         xm = 0.5 * (a + b);
@@ -104,7 +103,7 @@ double brentmin(double ax, double bx, double cx, double (Sgp4::*f)(double), doub
             d = C * (e = (x >= xm ? a - x : b - x));
         }
         u = (fabs(d) >= tol1 ? x + d : x + copysign(tol1, d));
-        fu = (obj->*f)(u);
+        fu = f(obj, u);
         /* This is the one function evaluation per iteration */
         if (fu <= fx) /* Now decide what to do with our func */
         {
@@ -149,11 +148,11 @@ double brentmin(double ax, double bx, double cx, double (Sgp4::*f)(double), doub
     return fx;
 }
 
-double zbrent(double (Sgp4::*func)(double), double x1, double x2, double tol, Sgp4* obj)
+double zbrent(brentfunc func, double x1, double x2, double tol, void *obj)
 {
     int iter;
     double a = x1, b = x2, c = x2, d, e, min1, min2;
-    double fa = (obj->*func)(a), fb = (obj->*func)(b), fc, p, q, r, s, tol1, xm;
+    double fa = func(obj, a), fb = func(obj, b), fc, p, q, r, s, tol1, xm;
 
     if ((fa > 0.0 && fb > 0.0) || (fa < 0.0 && fb < 0.0))
     {
@@ -231,7 +230,7 @@ double zbrent(double (Sgp4::*func)(double), double x1, double x2, double tol, Sg
         {
             b += copysign(tol1, xm);
         }
-        fb = (obj->*func)(b);
+        fb = func(obj, b);
     }
     //nrerror("Maximum number of iterations exceeded in zbrent");
     return -1.0;    /* Never get here */
@@ -0,0 +1,214 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Parallel initialisation of a whole catalog implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4bulk
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <sgp4/sgp4io.h>
+#include <sgp4/sgp4bulk.h>
+
+/* Work shared by the threads of one call */
+typedef struct
+{
+    gravconsttype whichconst;
+    char opsmode;
+    char **line1, **line2;
+    elsetrec *satrecs;
+    int *status;
+    size_t n;
+    size_t next;            /* First record not yet taken */
+    size_t nok, ndeep;
+    pthread_mutex_t lock;
+} bulkwork;
+
+static double bulk_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/* Checks the parts of the lines twoline2rv relies on */
+static bool bulk_format(const char *line1, const char *line2)
+{
+    if ((line1 == NULL) || (line2 == NULL))
+    {
+        return false;
+    }
+    if ((strnlen(line1, 69) < 69) || (strnlen(line2, 69) < 69))
+    {
+        return false;
+    }
+    if ((line1[0] != '1') || (line1[1] != ' ') || (line2[0] != '2') || (line2[1] != ' '))
+    {
+        return false;
+    }
+
+    return memcmp(&line1[2], &line2[2], 5) == 0;
+}
+
+/* Takes chunks of records until none is left */
+static void *bulk_worker(void *arg)
+{
+    bulkwork *work = (bulkwork *)arg;
+    size_t i, first, last, nok = 0, ndeep = 0;
+    int status;
+
+    while (true)
+    {
+        pthread_mutex_lock(&work->lock);
+        first = work->next;
+        last  = (work->n - first > SGP4_BULK_CHUNK) ? first + SGP4_BULK_CHUNK : work->n;
+        work->next = last;
+        pthread_mutex_unlock(&work->lock);
+
+        if (first >= last)
+        {
+            break;
+        }
+
+        for(i = first; i < last; i++)
+        {
+            if (bulk_format(work->line1[i], work->line2[i]))
+            {
+                twoline2rv(work->line1[i], work->line2[i], work->opsmode, work->whichconst, &work->satrecs[i]);
+                status = work->satrecs[i].error;
+            }
+            else
+            {
+                status = SGP4_BULK_EFORMAT;
+            }
+
+            if (status == SGP4_BULK_OK)
+            {
+                nok++;
+                if (work->satrecs[i].method == 'd')
+                {
+                    ndeep++;
+                }
+            }
+            if (work->status != NULL)
+            {
+                work->status[i] = status;
+            }
+        }
+    }
+
+    pthread_mutex_lock(&work->lock);
+    work->nok   += nok;
+    work->ndeep += ndeep;
+    pthread_mutex_unlock(&work->lock);
+
+    return NULL;
+}
+
+size_t sgp4_bulk_init(gravconsttype whichconst, char opsmode, char *line1[], char *line2[], size_t n,
+                      int nthreads, elsetrec satrecs[], int status[], sgp4_bulkstats_t *stats)
+{
+    bulkwork work;
+    pthread_t *threads = NULL;
+    double start = bulk_now();
+    int i, nstarted = 0;
+
+    if (nthreads <= 0)
+    {
+        nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if ((size_t)nthreads > (n + SGP4_BULK_CHUNK - 1) / SGP4_BULK_CHUNK)     /* No more threads than chunks */
+    {
+        nthreads = (int)((n + SGP4_BULK_CHUNK - 1) / SGP4_BULK_CHUNK);
+    }
+    if (nthreads < 1)
+    {
+        nthreads = 1;
+    }
+
+    work.whichconst = whichconst;
+    work.opsmode    = opsmode;
+    work.line1      = line1;
+    work.line2      = line2;
+    work.satrecs    = satrecs;
+    work.status     = status;
+    work.n          = n;
+    work.next       = 0;
+    work.nok        = 0;
+    work.ndeep      = 0;
+    pthread_mutex_init(&work.lock, NULL);
+
+    /* The calling thread is one of the workers. Threads that fail to start leave their share to the others */
+    if (nthreads > 1)
+    {
+        threads = (pthread_t *)malloc((nthreads - 1) * sizeof(pthread_t));
+    }
+    for(i = 0; (threads != NULL) && (i < nthreads - 1); i++)
+    {
+        if (pthread_create(&threads[nstarted], NULL, bulk_worker, &work) == 0)
+        {
+            nstarted++;
+        }
+    }
+
+    bulk_worker(&work);
+
+    for(i = 0; i < nstarted; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&work.lock);
+
+    if (stats != NULL)
+    {
+        stats->seconds  = bulk_now() - start;
+        stats->nthreads = nstarted + 1;
+        stats->nok      = work.nok;
+        stats->nfail    = n - work.nok;
+        stats->ndeep    = work.ndeep;
+    }
+
+    return work.nok;
+}
+
+/** \} End of sgp4bulk group */
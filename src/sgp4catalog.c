@@ -0,0 +1,338 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Catalog of element sets indexed by satellite number implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4catalog
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <sgp4/sgp4io.h>
+#include <sgp4/sgp4catalog.h>
+
+#define SGP4_CATALOG_SAMEEPOCH  1e-8        /* Epochs closer than this are the same (days) */
+#define SGP4_CATALOG_MINTABLE   64
+
+/* First slot to probe for a satellite number (Fibonacci hashing) */
+static size_t catalog_slot(long satnum, size_t tablesize)
+{
+    return (size_t)(((uint64_t)satnum * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & (tablesize - 1);
+}
+
+/* Slot holding the object, or the free slot where it would go */
+static size_t catalog_probe(const sgp4_catalog_t *cat, long satnum)
+{
+    size_t i = catalog_slot(satnum, cat->tablesize);
+
+    while ((cat->table[i] != 0) && (cat->objects[cat->table[i] - 1].satnum != satnum))
+    {
+        i = (i + 1) & (cat->tablesize - 1);
+    }
+
+    return i;
+}
+
+/* Rebuilds the table with the given number of slots */
+static bool catalog_rehash(sgp4_catalog_t *cat, size_t tablesize)
+{
+    uint32_t *old = cat->table;
+    size_t i;
+
+    cat->table = (uint32_t *)calloc(tablesize, sizeof(uint32_t));
+    if (cat->table == NULL)
+    {
+        cat->table = old;
+        return false;
+    }
+    cat->tablesize = tablesize;
+
+    for(i = 0; i < cat->nobjects; i++)
+    {
+        cat->table[catalog_probe(cat, cat->objects[i].satnum)] = (uint32_t)(i + 1);
+    }
+    free(old);
+
+    return true;
+}
+
+/* First element set with epoch after jd */
+static size_t catalog_after(const sgp4_history_t *obj, double jd)
+{
+    size_t lo = 0, hi = obj->n, mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (obj->satrecs[mid].jdsatepoch <= jd)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+static bool catalog_sgp4(gravconsttype whichconst, const elsetrec *satrec, double jd, double r[3], double v[3])
+{
+    sgp4_ctx_t ctx;
+
+    sgp4_ctx_init(&ctx);
+
+    return sgp4_r(whichconst, satrec, &ctx, (jd - satrec->jdsatepoch) * 1440.0, r, v);
+}
+
+bool sgp4_catalog_init(sgp4_catalog_t *cat, gravconsttype whichconst, size_t nobjects)
+{
+    size_t tablesize = SGP4_CATALOG_MINTABLE;
+
+    memset(cat, 0, sizeof(*cat));
+    cat->whichconst = whichconst;
+
+    while (tablesize < 2 * nobjects)
+    {
+        tablesize <<= 1;
+    }
+    cat->table = (uint32_t *)calloc(tablesize, sizeof(uint32_t));
+    if (cat->table == NULL)
+    {
+        return false;
+    }
+    cat->tablesize = tablesize;
+
+    if (nobjects > 0)
+    {
+        cat->objects = (sgp4_history_t *)malloc(nobjects * sizeof(sgp4_history_t));
+        cat->capobjects = (cat->objects != NULL) ? nobjects : 0;
+    }
+
+    return true;
+}
+
+void sgp4_catalog_free(sgp4_catalog_t *cat)
+{
+    size_t i;
+
+    for(i = 0; i < cat->nobjects; i++)
+    {
+        free(cat->objects[i].satrecs);
+    }
+    free(cat->objects);
+    free(cat->table);
+    memset(cat, 0, sizeof(*cat));
+}
+
+bool sgp4_catalog_add(sgp4_catalog_t *cat, const elsetrec *satrec)
+{
+    sgp4_history_t *obj, *objects;
+    elsetrec *satrecs;
+    size_t slot, k, cap;
+
+    slot = catalog_probe(cat, satrec->satnum);
+    if (cat->table[slot] == 0)
+    {
+        /* New object, keeping the table at most half full */
+        if (2 * (cat->nobjects + 1) > cat->tablesize)
+        {
+            if (!catalog_rehash(cat, 2 * cat->tablesize))
+            {
+                return false;
+            }
+            slot = catalog_probe(cat, satrec->satnum);
+        }
+        if (cat->nobjects == cat->capobjects)
+        {
+            cap = (cat->capobjects > 0) ? 2 * cat->capobjects : 64;
+            objects = (sgp4_history_t *)realloc(cat->objects, cap * sizeof(sgp4_history_t));
+            if (objects == NULL)
+            {
+                return false;
+            }
+            cat->objects = objects;
+            cat->capobjects = cap;
+        }
+
+        obj = &cat->objects[cat->nobjects];
+        memset(obj, 0, sizeof(*obj));
+        obj->satnum = satrec->satnum;
+        cat->table[slot] = (uint32_t)(++cat->nobjects);
+    }
+    obj = &cat->objects[cat->table[slot] - 1];
+
+    /* Histories mostly grow in epoch order, so the search usually ends at the last element set */
+    k = catalog_after(obj, satrec->jdsatepoch);
+    if ((k > 0) && (fabs(obj->satrecs[k - 1].jdsatepoch - satrec->jdsatepoch) < SGP4_CATALOG_SAMEEPOCH))
+    {
+        obj->satrecs[k - 1] = *satrec;
+        return true;
+    }
+
+    if (obj->n == obj->cap)
+    {
+        cap = (obj->cap > 0) ? 2 * obj->cap : 4;
+        satrecs = (elsetrec *)realloc(obj->satrecs, cap * sizeof(elsetrec));
+        if (satrecs == NULL)
+        {
+            return false;
+        }
+        obj->satrecs = satrecs;
+        obj->cap = cap;
+    }
+    memmove(&obj->satrecs[k + 1], &obj->satrecs[k], (obj->n - k) * sizeof(elsetrec));
+    obj->satrecs[k] = *satrec;
+    obj->n++;
+    cat->nrecords++;
+
+    return true;
+}
+
+size_t sgp4_catalog_load(sgp4_catalog_t *cat, sgp4_reader_t *rd, bool checksum, char opsmode)
+{
+    sgp4_entry_t entry;
+    elsetrec satrec;
+    size_t n = 0;
+
+    while (sgp4_reader_next(rd, checksum, opsmode, cat->whichconst, &entry, &satrec))
+    {
+        if ((entry.status == tle_ok) && sgp4_catalog_add(cat, &satrec))
+        {
+            n++;
+        }
+    }
+
+    return n;
+}
+
+const sgp4_history_t *sgp4_catalog_find(const sgp4_catalog_t *cat, long satnum)
+{
+    size_t slot;
+
+    if (cat->table == NULL)
+    {
+        return NULL;
+    }
+    slot = catalog_probe(cat, satnum);
+
+    return (cat->table[slot] != 0) ? &cat->objects[cat->table[slot] - 1] : NULL;
+}
+
+const elsetrec *sgp4_catalog_best(const sgp4_catalog_t *cat, long satnum, double jd, bool past)
+{
+    const sgp4_history_t *obj = sgp4_catalog_find(cat, satnum);
+    size_t k;
+
+    if ((obj == NULL) || (obj->n == 0))
+    {
+        return NULL;
+    }
+
+    k = catalog_after(obj, jd);
+    if (past)
+    {
+        return (k > 0) ? &obj->satrecs[k - 1] : NULL;
+    }
+    if (k == 0)
+    {
+        return &obj->satrecs[0];
+    }
+    if ((k == obj->n) || (jd - obj->satrecs[k - 1].jdsatepoch <= obj->satrecs[k].jdsatepoch - jd))
+    {
+        return &obj->satrecs[k - 1];
+    }
+
+    return &obj->satrecs[k];
+}
+
+bool sgp4_catalog_propagate(const sgp4_catalog_t *cat, long satnum, double jd, double r[3], double v[3])
+{
+    const elsetrec *satrec = sgp4_catalog_best(cat, satnum, jd, false);
+
+    return (satrec != NULL) && catalog_sgp4(cat->whichconst, satrec, jd, r, v);
+}
+
+bool sgp4_catalog_replay(const sgp4_catalog_t *cat, long satnum, double jdissue, double jd, double r[3],
+                         double v[3])
+{
+    const elsetrec *satrec = sgp4_catalog_best(cat, satnum, jdissue, true);
+
+    return (satrec != NULL) && catalog_sgp4(cat->whichconst, satrec, jd, r, v);
+}
+
+size_t sgp4_catalog_backtest(const sgp4_catalog_t *cat, long satnum, double maxspan, sgp4_backtest_t out[],
+                             size_t max)
+{
+    const sgp4_history_t *obj = sgp4_catalog_find(cat, satnum);
+    double r1[3], v1[3], r2[3], v2[3];
+    size_t i, j, n = 0;
+    double jdto;
+
+    if (obj == NULL)
+    {
+        return 0;
+    }
+
+    for(i = 0; i < obj->n; i++)
+    {
+        for(j = i + 1; (j < obj->n) && (n < max); j++)
+        {
+            jdto = obj->satrecs[j].jdsatepoch;
+            if (jdto - obj->satrecs[i].jdsatepoch > maxspan)
+            {
+                break;
+            }
+            if (!catalog_sgp4(cat->whichconst, &obj->satrecs[i], jdto, r1, v1) ||
+                !catalog_sgp4(cat->whichconst, &obj->satrecs[j], jdto, r2, v2))
+            {
+                continue;
+            }
+
+            out[n].jdfrom = obj->satrecs[i].jdsatepoch;
+            out[n].jdto   = jdto;
+            out[n].error  = sqrt((r1[0] - r2[0]) * (r1[0] - r2[0]) + (r1[1] - r2[1]) * (r1[1] - r2[1]) +
+                                 (r1[2] - r2[2]) * (r1[2] - r2[2]));
+            n++;
+        }
+    }
+
+    return n;
+}
+
+/** \} End of sgp4catalog group */
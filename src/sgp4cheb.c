@@ -0,0 +1,394 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Chebyshev ephemeris of a satellite implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4cheb
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <sgp4/sgp4cheb.h>
+
+#define SGP4_CHEB_MAGIC     "SGPC"
+#define SGP4_CHEB_VERSION   1
+#define SGP4_CHEB_MINSEG    1.0e-3  /* Shortest segment (minutes) */
+#define SGP4_CHEB_RESSTEP   720.0   /* Step of the resonance integrator in dspace (minutes) */
+
+/* Fit state shared by the segments of one fit */
+typedef struct
+{
+    gravconsttype whichconst;
+    const elsetrec *satrec;
+    sgp4_ctx_t ctx;
+    int n;                                                  /* Coefficients per axis */
+    double x[SGP4_CHEB_MAXORDER + 1];                       /* Nodes in [-1, 1] */
+    double cosk[SGP4_CHEB_MAXORDER + 1][SGP4_CHEB_MAXORDER + 1];
+} sgp4_cheb_fitter;
+
+/* Sum of a Chebyshev series and of its derivative at x */
+static void sgp4_cheb_sum(const double *c, int n, double x, double *p, double *dp)
+{
+    double tprev = 1.0, tcur = x, uprev = 0.0, ucur = 1.0, next;
+    int j;
+
+    *p  = c[0];
+    *dp = 0.0;
+
+    for(j = 1; j < n; j++)
+    {
+        *p  += c[j] * tcur;
+        *dp += c[j] * j * ucur;
+
+        next  = 2.0 * x * tcur - tprev;
+        tprev = tcur;
+        tcur  = next;
+        next  = 2.0 * x * ucur - uprev;
+        uprev = ucur;
+        ucur  = next;
+    }
+}
+
+/* Fits one segment and returns the largest position error between the nodes, or a
+   negative value if sgp4 fails */
+static double sgp4_cheb_segment(sgp4_cheb_fitter *fit, double t0, double t1, double *coef)
+{
+    double f[3][SGP4_CHEB_MAXORDER + 1];
+    double r[3], v[3], p, dp, x, d, dr, maxdr = 0.0;
+    int n = fit->n, j, k, i;
+
+    /* Nodes in increasing time, so the resonance integrator only moves forward */
+    for(k = n - 1; k >= 0; k--)
+    {
+        if (!sgp4_r(fit->whichconst, fit->satrec, &fit->ctx, 0.5 * (t0 + t1) + 0.5 * (t1 - t0) * fit->x[k], r, v))
+        {
+            return -1.0;
+        }
+        for(i = 0; i < 3; i++)
+        {
+            f[i][k] = r[i];
+        }
+    }
+
+    for(i = 0; i < 3; i++)
+    {
+        for(j = 0; j < n; j++)
+        {
+            d = 0.0;
+            for(k = 0; k < n; k++)
+            {
+                d += f[i][k] * fit->cosk[j][k];
+            }
+            coef[i * n + j] = (j == 0 ? 1.0 : 2.0) * d / n;
+        }
+    }
+
+    /* Check at both ends and halfway between the nodes */
+    for(k = n; k >= 0; k--)
+    {
+        if (k == n)
+        {
+            x = -1.0;
+        }
+        else if (k == 0)
+        {
+            x = 1.0;
+        }
+        else
+        {
+            x = 0.5 * (fit->x[k - 1] + fit->x[k]);
+        }
+
+        if (!sgp4_r(fit->whichconst, fit->satrec, &fit->ctx, 0.5 * (t0 + t1) + 0.5 * (t1 - t0) * x, r, v))
+        {
+            return -1.0;
+        }
+
+        dr = 0.0;
+        for(i = 0; i < 3; i++)
+        {
+            sgp4_cheb_sum(&coef[i * n], n, x, &p, &dp);
+            dr += (p - r[i]) * (p - r[i]);
+        }
+        if (dr > maxdr)
+        {
+            maxdr = dr;
+        }
+    }
+
+    return sqrt(maxdr);
+}
+
+/* Makes room for one more segment */
+static bool sgp4_cheb_grow(sgp4_cheb_t *cheb, size_t *cap)
+{
+    double *tseg, *coef;
+    size_t ncap;
+
+    if (cheb->nseg < *cap)
+    {
+        return true;
+    }
+
+    ncap = *cap == 0 ? 16 : 2 * *cap;
+
+    tseg = realloc(cheb->tseg, (ncap + 1) * sizeof(double));
+    if (tseg == NULL)
+    {
+        return false;
+    }
+    cheb->tseg = tseg;
+
+    coef = realloc(cheb->coef, ncap * 3 * (cheb->order + 1) * sizeof(double));
+    if (coef == NULL)
+    {
+        return false;
+    }
+    cheb->coef = coef;
+
+    *cap = ncap;
+
+    return true;
+}
+
+bool sgp4_cheb_fit(gravconsttype whichconst, const elsetrec *satrec, double tstart, double tstop,
+                   double tol, int order, sgp4_cheb_t *cheb)
+{
+    sgp4_cheb_fitter fit;
+    sgp4_ctx_t ctx0;
+    double t, len, maxlen, err;
+    size_t cap = 0;
+    int j, k;
+
+    memset(cheb, 0, sizeof(*cheb));
+
+    if (order == 0)
+    {
+        order = SGP4_CHEB_ORDER;
+    }
+    if ((order < 2) || (order > SGP4_CHEB_MAXORDER) || !(tstop > tstart) || !(tol > 0.0) || !(satrec->no > 0.0))
+    {
+        return false;
+    }
+
+    cheb->satnum     = satrec->satnum;
+    cheb->jdsatepoch = satrec->jdsatepoch;
+    cheb->order      = order;
+
+    fit.whichconst = whichconst;
+    fit.satrec     = satrec;
+    fit.n          = order + 1;
+    sgp4_ctx_init(&fit.ctx);
+    for(k = 0; k < fit.n; k++)
+    {
+        fit.x[k] = cos(pi * (k + 0.5) / fit.n);
+        for(j = 0; j < fit.n; j++)
+        {
+            fit.cosk[j][k] = cos(pi * j * (k + 0.5) / fit.n);
+        }
+    }
+
+    /* Segments start at a quarter of the period and grow back up to half of it */
+    len    = 0.25 * 2.0 * pi / satrec->no;
+    maxlen = 2.0 * len;
+
+    t = tstart;
+    while(t < tstop)
+    {
+        if (!sgp4_cheb_grow(cheb, &cap))
+        {
+            sgp4_cheb_free(cheb);
+            return false;
+        }
+
+        if (t + len > tstop)
+        {
+            len = tstop - t;
+        }
+        /* The resonance integrator has a kink at each of its steps, keep them on the bounds */
+        if ((satrec->irez != 0) && (t + len > (floor(t / SGP4_CHEB_RESSTEP) + 1.0) * SGP4_CHEB_RESSTEP))
+        {
+            len = (floor(t / SGP4_CHEB_RESSTEP) + 1.0) * SGP4_CHEB_RESSTEP - t;
+        }
+
+        ctx0 = fit.ctx;
+        for(;;)
+        {
+            err = sgp4_cheb_segment(&fit, t, t + len, &cheb->coef[cheb->nseg * 3 * fit.n]);
+            if (err < 0.0)
+            {
+                sgp4_cheb_free(cheb);
+                return false;
+            }
+            /* A segment that stays off even at the shortest length holds a jump of sgp4
+               itself (e.g. the lyddane switch in dpper), keep it as it is */
+            if ((err <= tol) || (len < 2.0 * SGP4_CHEB_MINSEG))
+            {
+                break;
+            }
+            len *= 0.5;
+            fit.ctx = ctx0;
+        }
+
+        cheb->tseg[cheb->nseg] = t;
+        cheb->nseg++;
+        t += len;
+
+        len = len * 2.0 < maxlen ? len * 2.0 : maxlen;
+    }
+    cheb->tseg[cheb->nseg] = tstop;
+
+    return true;
+}
+
+void sgp4_cheb_free(sgp4_cheb_t *cheb)
+{
+    free(cheb->tseg);
+    free(cheb->coef);
+
+    cheb->tseg = NULL;
+    cheb->coef = NULL;
+    cheb->nseg = 0;
+}
+
+bool sgp4_cheb_eval(const sgp4_cheb_t *cheb, double tsince, double r[3], double v[3])
+{
+    const double *coef;
+    size_t lo, hi, mid;
+    double t0, t1, x, p, dp;
+    int n = cheb->order + 1, i;
+
+    if ((cheb->nseg == 0) || !(tsince >= cheb->tseg[0]) || !(tsince <= cheb->tseg[cheb->nseg]))
+    {
+        return false;
+    }
+
+    /* Last segment starting at or before tsince */
+    lo = 0;
+    hi = cheb->nseg;
+    while(hi - lo > 1)
+    {
+        mid = (lo + hi) / 2;
+        if (cheb->tseg[mid] <= tsince)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    t0   = cheb->tseg[lo];
+    t1   = cheb->tseg[lo + 1];
+    x    = (2.0 * tsince - t0 - t1) / (t1 - t0);
+    coef = &cheb->coef[lo * 3 * n];
+
+    for(i = 0; i < 3; i++)
+    {
+        sgp4_cheb_sum(&coef[i * n], n, x, &p, &dp);
+        r[i] = p;
+        if (v != NULL)
+        {
+            v[i] = dp * 2.0 / ((t1 - t0) * 60.0);  /* km/min of x to km/s */
+        }
+    }
+
+    return true;
+}
+
+/* Layout: magic, version, satnum, jdsatepoch, order, nseg, tseg[nseg + 1], coef[...],
+   all in the byte order of the host */
+bool sgp4_cheb_write(const sgp4_cheb_t *cheb, FILE *f)
+{
+    uint32_t version = SGP4_CHEB_VERSION;
+    int32_t order = cheb->order;
+    int64_t satnum = cheb->satnum;
+    uint64_t nseg = cheb->nseg;
+    size_t ncoef = cheb->nseg * 3 * (cheb->order + 1);
+
+    return (fwrite(SGP4_CHEB_MAGIC, 4, 1, f) == 1) &&
+           (fwrite(&version, sizeof(version), 1, f) == 1) &&
+           (fwrite(&satnum, sizeof(satnum), 1, f) == 1) &&
+           (fwrite(&cheb->jdsatepoch, sizeof(double), 1, f) == 1) &&
+           (fwrite(&order, sizeof(order), 1, f) == 1) &&
+           (fwrite(&nseg, sizeof(nseg), 1, f) == 1) &&
+           (fwrite(cheb->tseg, sizeof(double), cheb->nseg + 1, f) == cheb->nseg + 1) &&
+           (fwrite(cheb->coef, sizeof(double), ncoef, f) == ncoef);
+}
+
+bool sgp4_cheb_read(sgp4_cheb_t *cheb, FILE *f)
+{
+    char magic[4];
+    uint32_t version;
+    int32_t order;
+    int64_t satnum;
+    uint64_t nseg;
+    size_t ncoef;
+
+    memset(cheb, 0, sizeof(*cheb));
+
+    if ((fread(magic, 4, 1, f) != 1) || (memcmp(magic, SGP4_CHEB_MAGIC, 4) != 0) ||
+        (fread(&version, sizeof(version), 1, f) != 1) || (version != SGP4_CHEB_VERSION) ||
+        (fread(&satnum, sizeof(satnum), 1, f) != 1) ||
+        (fread(&cheb->jdsatepoch, sizeof(double), 1, f) != 1) ||
+        (fread(&order, sizeof(order), 1, f) != 1) ||
+        (fread(&nseg, sizeof(nseg), 1, f) != 1) ||
+        (order < 2) || (order > SGP4_CHEB_MAXORDER) || (nseg == 0) || (nseg > SIZE_MAX / (3 * (SGP4_CHEB_MAXORDER + 1) * sizeof(double))))
+    {
+        return false;
+    }
+
+    cheb->satnum = (long int)satnum;
+    cheb->order  = order;
+    ncoef        = (size_t)nseg * 3 * (order + 1);
+
+    cheb->tseg = malloc(((size_t)nseg + 1) * sizeof(double));
+    cheb->coef = malloc(ncoef * sizeof(double));
+    if ((cheb->tseg == NULL) || (cheb->coef == NULL) ||
+        (fread(cheb->tseg, sizeof(double), (size_t)nseg + 1, f) != (size_t)nseg + 1) ||
+        (fread(cheb->coef, sizeof(double), ncoef, f) != ncoef))
+    {
+        sgp4_cheb_free(cheb);
+        return false;
+    }
+    cheb->nseg = (size_t)nseg;
+
+    return true;
+}
+
+/** \} End of sgp4cheb group */
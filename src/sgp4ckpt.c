@@ -0,0 +1,168 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Checkpointed deep space resonance integrator implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4ckpt
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sgp4/sgp4ckpt.h>
+
+#define SGP4_CKPT_STEP  720.0   /* Step of the resonance integrator in dspace (minutes) */
+
+/* Integrates from epoch in one direction, storing the state at each checkpoint. sgp4_r
+   stops the integrator exactly at tsince when tsince is a multiple of the step. */
+static void sgp4_ckpt_fill(gravconsttype whichconst, const elsetrec *satrec, double spacing,
+                           sgp4_ckpt_point_t *pts, size_t n)
+{
+    sgp4_ctx_t ctx;
+    double r[3], v[3];
+    size_t k;
+
+    sgp4_ctx_init(&ctx);
+
+    for(k = 0; k < n; k++)
+    {
+        sgp4_r(whichconst, satrec, &ctx, (double)(k + 1) * spacing, r, v);
+
+        pts[k].atime = ctx.atime;
+        pts[k].xli   = ctx.xli;
+        pts[k].xni   = ctx.xni;
+    }
+}
+
+bool sgp4_ckpt_build(gravconsttype whichconst, const elsetrec *satrec, double tmin, double tmax,
+                     double spacing, sgp4_ckpt_t *ckpt)
+{
+    double steps;
+
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    steps = ceil(spacing / SGP4_CKPT_STEP);
+    if (!(steps >= 1.0))
+    {
+        steps = 1.0;
+    }
+    ckpt->spacing = steps * SGP4_CKPT_STEP;
+
+    if ((satrec->method != 'd') || (satrec->irez == 0))
+    {
+        return true;
+    }
+
+    if (tmax > 0.0)
+    {
+        ckpt->nfwd = (size_t)floor(tmax / ckpt->spacing);
+    }
+    if (tmin < 0.0)
+    {
+        ckpt->nbwd = (size_t)floor(-tmin / ckpt->spacing);
+    }
+
+    if (ckpt->nfwd > 0)
+    {
+        ckpt->fwd = malloc(ckpt->nfwd * sizeof(sgp4_ckpt_point_t));
+    }
+    if (ckpt->nbwd > 0)
+    {
+        ckpt->bwd = malloc(ckpt->nbwd * sizeof(sgp4_ckpt_point_t));
+    }
+    if (((ckpt->nfwd > 0) && (ckpt->fwd == NULL)) || ((ckpt->nbwd > 0) && (ckpt->bwd == NULL)))
+    {
+        sgp4_ckpt_free(ckpt);
+        return false;
+    }
+
+    sgp4_ckpt_fill(whichconst, satrec, ckpt->spacing, ckpt->fwd, ckpt->nfwd);
+    sgp4_ckpt_fill(whichconst, satrec, -ckpt->spacing, ckpt->bwd, ckpt->nbwd);
+
+    return true;
+}
+
+void sgp4_ckpt_free(sgp4_ckpt_t *ckpt)
+{
+    free(ckpt->fwd);
+    free(ckpt->bwd);
+
+    ckpt->fwd  = NULL;
+    ckpt->bwd  = NULL;
+    ckpt->nfwd = 0;
+    ckpt->nbwd = 0;
+}
+
+void sgp4_ckpt_seed(const sgp4_ckpt_t *ckpt, sgp4_ctx_t *ctx, double tsince)
+{
+    const sgp4_ckpt_point_t *pt;
+    size_t n;
+    double k;
+
+    n = tsince > 0.0 ? ckpt->nfwd : ckpt->nbwd;
+
+    k = floor(fabs(tsince) / ckpt->spacing);
+    if (k > (double)n)
+    {
+        k = (double)n;
+    }
+    if (k < 1.0)
+    {
+        return;
+    }
+
+    pt = tsince > 0.0 ? &ckpt->fwd[(size_t)k - 1] : &ckpt->bwd[(size_t)k - 1];
+
+    /* dspace resumes from the context when it lies between the checkpoint and tsince */
+    if ((ctx->atime * tsince > 0.0) && (fabs(ctx->atime) <= fabs(tsince)) &&
+        (fabs(ctx->atime) >= fabs(pt->atime)))
+    {
+        return;
+    }
+
+    ctx->atime = pt->atime;
+    ctx->xli   = pt->xli;
+    ctx->xni   = pt->xni;
+}
+
+bool sgp4_ckpt(gravconsttype whichconst, const elsetrec *satrec, const sgp4_ckpt_t *ckpt,
+               sgp4_ctx_t *ctx, double tsince, double r[3], double v[3])
+{
+    sgp4_ckpt_seed(ckpt, ctx, tsince);
+
+    return sgp4_r(whichconst, satrec, ctx, tsince, r, v);
+}
+
+/** \} End of sgp4ckpt group */
@@ -0,0 +1,246 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Compact records split into hot, deep space and cold parts implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4compact
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <sgp4/sgp4ext.h>
+#include <sgp4/sgp4compact.h>
+
+/* Fields of each part, shared by the split and the join */
+#define COMPACT_HOT(X)                                                                  \
+    X(satnum)   X(error)    X(operationmode) X(init)   X(method)   X(isimp)    X(variant)  \
+    X(t)        X(jdsatepoch)                                                       \
+    X(aycof)    X(con41)    X(cc1)      X(cc4)      X(cc5)      X(d2)       X(d3)       X(d4)       \
+    X(delmo)    X(eta)      X(argpdot)  X(omgcof)   X(sinmao)   X(t2cof)    X(t3cof)    X(t4cof)    \
+    X(t5cof)    X(x1mth2)   X(x7thm1)   X(mdot)     X(nodedot)  X(xlcof)    X(xmcof)    X(nodecf)   \
+    X(bstar)    X(inclo)    X(nodeo)    X(ecco)     X(argpo)    X(mo)       X(no)
+
+#define COMPACT_DEEP(X)                                                                 \
+    X(irez)                                                                             \
+    X(d2201)    X(d2211)    X(d3210)    X(d3222)    X(d4410)    X(d4422)    X(d5220)    X(d5232)    \
+    X(d5421)    X(d5433)    X(dedt)     X(del1)     X(del2)     X(del3)     X(didt)     X(dmdt)     \
+    X(dnodt)    X(domdt)    X(e3)       X(ee2)      X(peo)      X(pgho)     X(pho)      X(pinco)    \
+    X(plo)      X(se2)      X(se3)      X(sgh2)     X(sgh3)     X(sgh4)     X(sh2)      X(sh3)      \
+    X(si2)      X(si3)      X(sl2)      X(sl3)      X(sl4)      X(gsto)     X(xfact)    X(xgh2)     \
+    X(xgh3)     X(xgh4)     X(xh2)      X(xh3)      X(xi2)      X(xi3)      X(xl2)      X(xl3)      \
+    X(xl4)      X(xlamo)    X(zmol)     X(zmos)     X(atime)    X(xli)      X(xni)
+
+#define COMPACT_COLD(X)                                                                 \
+    X(epochyr)  X(epochtynumrev) X(epochdays) X(ndot)   X(nddot)    X(a)        X(alta)     X(altp)     \
+    X(rcse)
+
+#define COMPACT_COPY(f)     dst->f = src->f;
+
+/* Deep space integrator state written back by sgp4 */
+#define COMPACT_STATE(X)    X(atime) X(xli) X(xni)
+
+/* Gravity constants used by the near earth path, resolved once per call or batch */
+typedef struct
+{
+    double radiusearthkm, xke, j2, vkmpersec;
+} compactconsts;
+
+static void compact_consts(gravconsttype whichconst, compactconsts *consts)
+{
+    double tumin, mu, j3, j4, j3oj2;
+
+    getgravconst(whichconst, &tumin, &mu, &consts->radiusearthkm, &consts->xke, &consts->j2, &j3, &j4, &j3oj2);
+    consts->vkmpersec = consts->radiusearthkm * consts->xke / 60.0;
+}
+
+/* Near earth path of sgp4_kernel (sgp4unit.c), generated for the hot record */
+#define SGP4_KERNEL_FN      compact_kernel
+#define SGP4_KERNEL_REC     elsetrechot
+#define SGP4_KERNEL_CONSTS  compactconsts
+#define SGP4_KERNEL_DEEP    0
+#include "sgp4unit_kernel.h"
+#undef SGP4_KERNEL_FN
+#undef SGP4_KERNEL_REC
+#undef SGP4_KERNEL_CONSTS
+#undef SGP4_KERNEL_DEEP
+
+static bool compact_near(const compactconsts *consts, elsetrechot *hot, double tsince, double r[3], double v[3])
+{
+    sgp4_ctx_t ctx;
+    bool ok;
+
+    ok = compact_kernel(consts, hot, &ctx, tsince, r, v, hot->isimp == 1 ? sgp4_near_simple : sgp4_near_full, 'i');
+
+    hot->t     = ctx.t;
+    hot->error = ctx.error;
+
+    return ok;
+}
+
+bool elsetrec2hot(const elsetrec *satrec, elsetrechot *hot, elsetreccold *cold)
+{
+    const elsetrec *src = satrec;
+    elsetrechot *dst = hot;
+
+    COMPACT_HOT(COMPACT_COPY)
+    hot->deep = NULL;
+
+    if (cold != NULL)
+    {
+        elsetreccold *dst = cold;
+
+        COMPACT_COLD(COMPACT_COPY)
+    }
+
+    if (satrec->method == 'd')
+    {
+        elsetrecdeep *dst = (elsetrecdeep *)malloc(sizeof(elsetrecdeep));
+
+        if (dst == NULL)
+        {
+            return false;
+        }
+        COMPACT_DEEP(COMPACT_COPY)
+        hot->deep = dst;
+    }
+
+    return true;
+}
+
+void elsetrechot2rec(const elsetrechot *hot, const elsetreccold *cold, elsetrec *satrec)
+{
+    elsetrec *dst = satrec;
+
+    memset(satrec, 0, sizeof(*satrec));
+    {
+        const elsetrechot *src = hot;
+
+        COMPACT_HOT(COMPACT_COPY)
+    }
+    if (cold != NULL)
+    {
+        const elsetreccold *src = cold;
+
+        COMPACT_COLD(COMPACT_COPY)
+    }
+    if (hot->deep != NULL)
+    {
+        const elsetrecdeep *src = hot->deep;
+
+        COMPACT_DEEP(COMPACT_COPY)
+    }
+}
+
+void elsetrechot_free(elsetrechot *hot)
+{
+    free(hot->deep);
+    hot->deep = NULL;
+}
+
+/* Propagates near earth records with the constants given, deep space ones through sgp4 */
+static bool compact_sgp4(gravconsttype whichconst, const compactconsts *consts, elsetrechot *hot, double tsince,
+                         double r[3], double v[3])
+{
+    elsetrec satrec;
+    bool ok;
+
+    if (hot->deep == NULL)
+    {
+        return compact_near(consts, hot, tsince, r, v);
+    }
+
+    /* Deep space records go through sgp4 on a full copy, keeping its outputs */
+    elsetrechot2rec(hot, NULL, &satrec);
+    ok = sgp4(whichconst, &satrec, tsince, r, v);
+    hot->t     = satrec.t;
+    hot->error = satrec.error;
+    {
+        const elsetrec *src = &satrec;
+        elsetrecdeep *dst = hot->deep;
+
+        COMPACT_STATE(COMPACT_COPY)
+    }
+
+    return ok;
+}
+
+bool sgp4hot(gravconsttype whichconst, elsetrechot *hot, double tsince, double r[3], double v[3])
+{
+    compactconsts consts;
+
+    compact_consts(whichconst, &consts);
+
+    return compact_sgp4(whichconst, &consts, hot, tsince, r, v);
+}
+
+size_t sgp4hot_batch(gravconsttype whichconst, elsetrechot hots[], size_t n, double jd, sgp4_soa_t *out)
+{
+    compactconsts consts;
+    double r[3], v[3];
+    size_t i, nok = 0;
+
+    compact_consts(whichconst, &consts);
+
+    for(i = 0; i < n; i++)
+    {
+        r[0] = r[1] = r[2] = NAN;
+        v[0] = v[1] = v[2] = NAN;
+
+        if (compact_sgp4(whichconst, &consts, &hots[i], (jd - hots[i].jdsatepoch) * 1440.0, r, v))
+        {
+            nok++;
+        }
+
+        out->x[i] = r[0];
+        out->y[i] = r[1];
+        out->z[i] = r[2];
+        if (out->vx != NULL)
+        {
+            out->vx[i] = v[0];
+            out->vy[i] = v[1];
+            out->vz[i] = v[2];
+        }
+        if (out->error != NULL)
+        {
+            out->error[i] = hots[i].error;
+        }
+    }
+
+    return nok;
+}
+
+/** \} End of sgp4compact group */
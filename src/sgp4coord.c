@@ -9,12 +9,22 @@ Ported to C++ by Grady Hillhouse with some modifications, July 2015.
 */
 #include "sgp4coord.h"
 #include "sgp4ext.h"
+#include "sgp4eop.h"
+
+#define au  149597871     /* km */
+
+//Earth's angular rotation rate (rad/s)
+//Note: I don't have a good source for LOD. Historically it has been on the order of 2 ms so I'm just using that as a constant. The effect is very small.
+#define omegaearth  (7.29211514670698e-05 * (1.0  - 0.0015563/86400.0))
+
+static double coord_eop(double jd, double pm[3][3]);
 
 /*
 teme2ecef
 
 This function transforms a vector from a true equator mean equinox (TEME)
-frame to an earth-centered, earth-fixed (ECEF) frame.
+frame to an earth-centered, earth-fixed (ECEF) frame. teme2ecef transforms
+the position only, teme2ecefv the position and the velocity.
 
 Author: David Vallado, 2007
 Ported to C++ by Grady Hillhouse with some modifications, July 2015.
@@ -29,18 +39,15 @@ recef           Position vector (ECEF)          km
 vecef           Velocity vector (ECEF)          km/s
 */
 
-//void teme2ecef(double rteme[3], double vteme[3], double jdut1, double recef[3], double vecef[3])
 void teme2ecef(double rteme[3], double jdut1, double recef[3])
 {
     double gmst;
     double st[3][3];
     double rpef[3];
-    //double vpef[3];
     double pm[3][3];
-    //double omegaearth[3];
     
-    //Get Greenwich mean sidereal time
-    gmst = gstime(jdut1);
+    //Get polar motion vector, and Greenwich mean sidereal time of the UT1 date
+    gmst = gstime(coord_eop(jdut1, pm));
     
     //st is the pef - tod matrix
     st[0][0] = cos(gmst);
@@ -58,37 +65,27 @@ void teme2ecef(double rteme[3], double jdut1, double recef[3])
     rpef[1] = st[0][1] * rteme[0] + st[1][1] * rteme[1] + st[2][1] * rteme[2];
     rpef[2] = st[0][2] * rteme[0] + st[1][2] * rteme[1] + st[2][2] * rteme[2];
     
-    //Get polar motion vector
-    polarm(jdut1, pm);
-    
     //ECEF postion vector is the inverse of the polar motion vector multiplied by rpef
     recef[0] = pm[0][0] * rpef[0] + pm[1][0] * rpef[1] + pm[2][0] * rpef[2];
     recef[1] = pm[0][1] * rpef[0] + pm[1][1] * rpef[1] + pm[2][1] * rpef[2];
     recef[2] = pm[0][2] * rpef[0] + pm[1][2] * rpef[1] + pm[2][2] * rpef[2];
+}
+
+void teme2ecefv(double rteme[3], double vteme[3], double jdut1, double recef[3], double vecef[3])
+{
+    sgp4_frame_t frame;
     
-    //Earth's angular rotation vector (omega)
-    //Note: I don't have a good source for LOD. Historically it has been on the order of 2 ms so I'm just using that as a constant. The effect is very small.
-    //omegaearth[0] = 0.0;
-    //omegaearth[1] = 0.0;
-    //omegaearth[2] = 7.29211514670698e-05 * (1.0  - 0.0015563/86400.0);
-    
-    //Pseudo Earth Fixed velocity vector is st'*vteme - omegaearth X rpef
-    //vpef[0] = st[0][0] * vteme[0] + st[1][0] * vteme[1] + st[2][0] * vteme[2] - (omegaearth[1]*rpef[2] - omegaearth[2]*rpef[1]);
-    //vpef[1] = st[0][1] * vteme[0] + st[1][1] * vteme[1] + st[2][1] * vteme[2] - (omegaearth[2]*rpef[0] - omegaearth[0]*rpef[2]);
-    //vpef[2] = st[0][2] * vteme[0] + st[1][2] * vteme[1] + st[2][2] * vteme[2] - (omegaearth[0]*rpef[1] - omegaearth[1]*rpef[0]);
-    
-    //ECEF velocty vector is the inverse of the polar motion vector multiplied by vpef
-    //vecef[0] = pm[0][0] * vpef[0] + pm[1][0] * vpef[1] + pm[2][0] * vpef[2];
-    //vecef[1] = pm[0][1] * vpef[0] + pm[1][1] * vpef[1] + pm[2][1] * vpef[2];
-    //vecef[2] = pm[0][2] * vpef[0] + pm[1][2] * vpef[1] + pm[2][2] * vpef[2];
+    framerotation(jdut1, &frame);
+    teme2ecefv_frame(rteme, vteme, &frame, recef, vecef);
 }
 
 /*
 polarm
 
 This function calulates the transformation matrix that accounts for polar
-motion. Polar motion coordinates are estimated using IERS Bulletin
-rather than directly input for simplicity.
+motion. Polar motion coordinates are interpolated from the EOP table
+installed with sgp4_eop_use when it covers the date, and otherwise
+estimated using IERS Bulletin rather than directly input for simplicity.
 
 Author: David Vallado, 2007
 Ported to C++ by Grady Hillhouse with some modifications, July 2015.
@@ -100,7 +97,8 @@ OUTPUTS         DESCRIPTION
 pm              Transformation matrix for ECEF - PEF
 */
 
-void polarm(double jdut1, double pm[3][3])
+/* Built-in polar motion model, used without an EOP table */
+static void polarm_bulletin(double jdut1, double pm[3][3])
 {
     double MJD; //Julian Date - 2,400,000.5 days
     double A;
@@ -127,6 +125,205 @@ void polarm(double jdut1, double pm[3][3])
     pm[2][2] = cos(xp) * cos(yp);
 }
 
+/* Polar motion matrix from the table values, with sin to third and cos to second order (exact for arcsec angles) */
+static void polarm_eop(double xp, double yp, double pm[3][3])
+{
+    double cx = 1.0 - 0.5*xp*xp, sx = xp - xp*xp*xp/6.0;
+    double cy = 1.0 - 0.5*yp*yp, sy = yp - yp*yp*yp/6.0;
+    
+    pm[0][0] = cx;
+    pm[0][1] = 0.0;
+    pm[0][2] = -sx;
+    pm[1][0] = sx * sy;
+    pm[1][1] = cy;
+    pm[1][2] = cx * sy;
+    pm[2][0] = sx * cy;
+    pm[2][1] = -sy;
+    pm[2][2] = cx * cy;
+}
+
+/* Polar motion matrix of a date, returns the UT1 date (the same date without a table covering it) */
+static double coord_eop(double jd, double pm[3][3])
+{
+    const sgp4_eop_t *eop = sgp4_eop_current();
+    double xp, yp, dut1;
+    
+    if ((eop != NULL) && sgp4_eop_get(eop, jd, &xp, &yp, &dut1))
+    {
+        polarm_eop(xp, yp, pm);
+        return jd + dut1 / 86400.0;
+    }
+    
+    polarm_bulletin(jd, pm);
+    
+    return jd;
+}
+
+void polarm(double jdut1, double pm[3][3])
+{
+    coord_eop(jdut1, pm);
+}
+
+/*
+% ------------------------------------------------------------------------------
+%
+%                           function sun
+%
+%
+%  author        : david vallado                  719-573-2600   27 may 2002
+%
+%  revisions
+%    vallado     - fix mean lon of sun                            7 mat 2004
+%
+%  inputs          description                    range / units
+%    jdC          - julian date                    days from 4713 bc
+%
+%  outputs       :
+%    rsun        - ijk position vector of the sun km
+
+%  locals        :
+%    meanlong    - mean longitude
+%    meananomaly - mean anomaly
+%    eclplong    - ecliptic longitude
+%    obliquity   - mean obliquity of the ecliptic
+%    tut1        - julian centuries of ut1 from
+%                  jan 1, 2000 12h
+%    ttdb        - julian centuries of tdb from
+%                  jan 1, 2000 12h
+%    hr          - hours                          0 .. 24              10
+%    min         - minutes                        0 .. 59              15
+%    sec         - seconds                        0.0  .. 59.99          30.00
+%    temp        - temporary variable
+%    deg         - degrees
+%
+%  coupling      :
+%    none.
+%
+%  references    :
+%    vallado       2007, 281, alg 29, ex 5-1
+%
+% [rsun,rtasc,decl] = sun ( jdC );
+% ------------------------------------------------------------------------------
+*/
+
+void sun(double jd, double rsun[3])
+{
+    double twopi    = 2.0 * pi;
+    double deg2rad  = pi / 180.0;
+
+    // -------------------------  implementation   -----------------
+    // -------------------  initialize values   --------------------
+    double tut1 = (jd - 2451545.0) / 36525.0;
+
+    double meanlong = 280.460 + 36000.77 * tut1;
+    meanlong = floatmod(meanlong, 360.0);   /* deg */
+
+    double meananomaly = 357.5277233 + 35999.05034 * tut1;
+    meananomaly = floatmod(meananomaly * deg2rad, twopi);   /* rad */
+    if (meananomaly < 0.0)
+    {
+        meananomaly = twopi + meananomaly;
+    }
+
+    double eclplong = meanlong + 1.914666471 * sin(meananomaly) + 0.019994643 * sin(2.0 * meananomaly); /* deg */
+    eclplong= floatmod(eclplong, 360.0);    /* deg */
+
+    double obliquity = 23.439291 - 0.0130042 * tut1;    /* deg */
+
+    eclplong = eclplong * deg2rad;
+    obliquity = obliquity * deg2rad;
+
+    // --------- find magnitude of sun vector, )   components ------
+    double magr= 1.000140612 - 0.016708617 * cos(meananomaly) - 0.000139589 * cos(2.0 * meananomaly);   /* in au's */
+
+    rsun[0] = magr * cos(eclplong) * au;
+    rsun[1] = magr * cos(obliquity) * sin(eclplong) * au;
+    rsun[2] = magr * sin(obliquity) * sin(eclplong) * au;
+}
+
+/*
+frameinit, framerotation, teme2ecef_frame, rv2azel_frame
+
+Everything teme2ecef, rv2azel and the visibility functions compute from the
+julian date alone, computed once for all the satellites evaluated at that date.
+Results are identical to teme2ecef and rv2azel with the same julian date.
+framerotation leaves out the sun vector, for callers that may not need it.
+teme2ecefv_frame also transforms the velocity (see teme2ecefv).
+*/
+
+void frameinit(double jdut1, sgp4_frame_t *frame)
+{
+    framerotation(jdut1, frame);
+    sun(jdut1, frame->rsun);
+}
+
+void framerotation(double jdut1, sgp4_frame_t *frame)
+{
+    double gmst = gstime(coord_eop(jdut1, frame->pm));
+    
+    frame->jdut1 = jdut1;
+    frame->gmst  = gmst;
+    
+    frame->st[0][0] = cos(gmst);
+    frame->st[0][1] = -sin(gmst);
+    frame->st[0][2] = 0.0;
+    frame->st[1][0] = sin(gmst);
+    frame->st[1][1] = cos(gmst);
+    frame->st[1][2] = 0.0;
+    frame->st[2][0] = 0.0;
+    frame->st[2][1] = 0.0;
+    frame->st[2][2] = 1.0;
+}
+
+void teme2ecef_frame(const double rteme[3], const sgp4_frame_t *frame, double recef[3])
+{
+    const double (*st)[3] = frame->st;
+    const double (*pm)[3] = frame->pm;
+    double rpef[3];
+    
+    rpef[0] = st[0][0] * rteme[0] + st[1][0] * rteme[1] + st[2][0] * rteme[2];
+    rpef[1] = st[0][1] * rteme[0] + st[1][1] * rteme[1] + st[2][1] * rteme[2];
+    rpef[2] = st[0][2] * rteme[0] + st[1][2] * rteme[1] + st[2][2] * rteme[2];
+    
+    recef[0] = pm[0][0] * rpef[0] + pm[1][0] * rpef[1] + pm[2][0] * rpef[2];
+    recef[1] = pm[0][1] * rpef[0] + pm[1][1] * rpef[1] + pm[2][1] * rpef[2];
+    recef[2] = pm[0][2] * rpef[0] + pm[1][2] * rpef[1] + pm[2][2] * rpef[2];
+}
+
+void rv2azel_frame(const double ro[3], double latgd, double lon, double alt, const sgp4_frame_t *frame, double razel[3])
+{
+    double recef[3];
+    
+    teme2ecef_frame(ro, frame, recef);
+    ecef2azel(recef, latgd, lon, alt, razel);
+}
+
+void teme2ecefv_frame(const double rteme[3], const double vteme[3], const sgp4_frame_t *frame, double recef[3], double vecef[3])
+{
+    const double (*st)[3] = frame->st;
+    const double (*pm)[3] = frame->pm;
+    double rpef[3];
+    double vpef[3];
+    
+    rpef[0] = st[0][0] * rteme[0] + st[1][0] * rteme[1] + st[2][0] * rteme[2];
+    rpef[1] = st[0][1] * rteme[0] + st[1][1] * rteme[1] + st[2][1] * rteme[2];
+    rpef[2] = st[0][2] * rteme[0] + st[1][2] * rteme[1] + st[2][2] * rteme[2];
+    
+    recef[0] = pm[0][0] * rpef[0] + pm[1][0] * rpef[1] + pm[2][0] * rpef[2];
+    recef[1] = pm[0][1] * rpef[0] + pm[1][1] * rpef[1] + pm[2][1] * rpef[2];
+    recef[2] = pm[0][2] * rpef[0] + pm[1][2] * rpef[1] + pm[2][2] * rpef[2];
+    
+    //Pseudo Earth Fixed velocity vector is st'*vteme - omegaearth X rpef, with omegaearth along z
+    vpef[0] = st[0][0] * vteme[0] + st[1][0] * vteme[1] + st[2][0] * vteme[2] + omegaearth * rpef[1];
+    vpef[1] = st[0][1] * vteme[0] + st[1][1] * vteme[1] + st[2][1] * vteme[2] - omegaearth * rpef[0];
+    vpef[2] = st[0][2] * vteme[0] + st[1][2] * vteme[1] + st[2][2] * vteme[2];
+    
+    //ECEF velocty vector is the inverse of the polar motion vector multiplied by vpef
+    vecef[0] = pm[0][0] * vpef[0] + pm[1][0] * vpef[1] + pm[2][0] * vpef[2];
+    vecef[1] = pm[0][1] * vpef[0] + pm[1][1] * vpef[1] + pm[2][1] * vpef[2];
+    vecef[2] = pm[0][2] * vpef[0] + pm[1][2] * vpef[1] + pm[2][2] * vpef[2];
+}
+
 /*
 ijk2ll
 
@@ -252,7 +449,8 @@ void site(double latgd, double lon, double alt, double rs[3])
 rv2azel
 
 This function calculates the range, elevation, and azimuth (and their rates)
-from the TEME vectors output by the SGP4 function.
+from the TEME vectors output by the SGP4 function. rv2azel calculates the
+range, azimuth and elevation only, rv2azelrates also their rates.
 
 Author: David Vallado, 2007
 Ported to C++ by Grady Hillhouse with some modifications, July 2015.
@@ -270,39 +468,61 @@ razel           Range, azimuth, and elevation matrix
 razelrates      Range rate, azimuth rate, and elevation rate matrix
 */
 
-//void rv2azel(double ro[3], double vo[3], double latgd, double lon, double alt, double jdut1, double razel[3], double razelrates[3])
 void rv2azel(double ro[3], double latgd, double lon, double alt, double jdut1, double razel[3])
+{
+    double recef[3];
+    
+    //Convert TEME vectors to ECEF coordinate system
+    teme2ecef(ro, jdut1, recef);
+    
+    ecef2azel(recef, latgd, lon, alt, razel);
+}
+
+void rv2azelrates(double ro[3], double vo[3], double latgd, double lon, double alt, double jdut1, double razel[3], double razelrates[3])
+{
+    sgp4_observer_t obs;
+    sgp4_frame_t frame;
+    
+    observerinit(latgd, lon, alt, &obs);
+    framerotation(jdut1, &frame);
+    rv2azelrates_observer(ro, vo, &obs, &frame, razel, razelrates);
+}
+
+/*
+ecef2azel
+
+Second half of rv2azel, from the ECEF position vector of the satellite.
+
+INPUTS          DESCRIPTION                     RANGE/UNITS
+recef           Sat. position vector (ECEF)     km
+latgd           Site geodetic latitude          -pi/2 to pi/2 in radians
+lon             Site longitude                  -2pi to 2pi in radians
+alt             Site altitude                   km
+
+OUTPUTS         DESCRIPTION
+razel           Range, azimuth, and elevation matrix
+*/
+
+void ecef2azel(const double recef[3], double latgd, double lon, double alt, double razel[3])
 {
     //Locals
     double halfpi = pi * 0.5;
     double small  = 0.00000001;
     double temp;
     double rs[3];
-    //double vs[3];
-    double recef[3];
-    //double vecef[3];
     double rhoecef[3];
-    //double drhoecef[3];
     double tempvec[3];
     double rhosez[3];
-    //double drhosez[3];
     double magrhosez;
     double rho, az, el;
-    //double drho, daz, del;
     
     //Get site vector in ECEF coordinate system
-    //site(latgd, lon, alt, rs, vs);
     site(latgd, lon, alt, rs);
     
-    //Convert TEME vectors to ECEF coordinate system
-    //teme2ecef(ro, vo, jdut1, recef, vecef);
-    teme2ecef(ro, jdut1, recef);
-    
     //Find ECEF range vectors
     for (int i = 0; i < 3; i++)
     {
         rhoecef[i] = recef[i] - rs[i];
-        //drhoecef[i] = vecef[i];
     }
     rho = mag(rhoecef); //Range in km
     
@@ -310,16 +530,12 @@ void rv2azel(double ro[3], double latgd, double lon, double alt, double jdut1, d
     rot3(rhoecef, lon, tempvec);
     rot2(tempvec, (halfpi-latgd), rhosez);
     
-    //rot3(drhoecef, lon, tempvec);
-    //rot2(tempvec, (halfpi-latgd), drhosez);
-    
     //Calculate azimuth, and elevation
     temp = sqrt(rhosez[0]*rhosez[0] + rhosez[1]*rhosez[1]);
     if (temp < small)
     {
         el = sgn(rhosez[2]) * halfpi;
-        //az = atan2(drhosez[1], -drhosez[0]);
-        az = NAN;
+        az = NAN;   //Undefined without the velocity (see ecef2azelrates_observer)
     }
     else
     {
@@ -328,8 +544,147 @@ void rv2azel(double ro[3], double latgd, double lon, double alt, double jdut1, d
         az = atan2(rhosez[1], -rhosez[0]);
     }
     
+    //Move values to output vectors
+    razel[0] = rho;             //Range (km)
+    razel[1] = az;              //Azimuth (radians)
+    razel[2] = el;              //Elevation (radians)
+}
+
+/*
+observerinit, ecef2azel_observer, rv2azel_observer, sinel_observer
+
+Everything rv2azel computes from the site alone, computed once for a site that
+does not move. ecef2azel_observer gives the same results as ecef2azel, and
+sinel_observer the sine of the elevation alone, for root finding and other tests
+that do not need the range and azimuth. ecef2azelrates_observer also gives the
+rates from the ECEF velocity vector, with the formulas of Vallado's rv2azel: at
+the zenith or nadir the azimuth is the direction of motion and both angle rates
+are zero.
+*/
+
+void observerinit(double latgd, double lon, double alt, sgp4_observer_t *obs)
+{
+    double halfpi = pi * 0.5;
+    
+    obs->latgd = latgd;
+    obs->lon   = lon;
+    obs->alt   = alt;
+    site(latgd, lon, alt, obs->rs);
+    
+    //Trig of the rot3 and rot2 rotations to SEZ
+    obs->clon = cos(lon);
+    obs->slon = sin(lon);
+    obs->ccolat = cos(halfpi - latgd);
+    obs->scolat = sin(halfpi - latgd);
+    
+    //SEZ unit vectors in ECEF
+    obs->south[0] = obs->ccolat * obs->clon;
+    obs->south[1] = obs->ccolat * obs->slon;
+    obs->south[2] = -obs->scolat;
+    obs->east[0]  = -obs->slon;
+    obs->east[1]  = obs->clon;
+    obs->east[2]  = 0.0;
+    obs->up[0]    = obs->scolat * obs->clon;
+    obs->up[1]    = obs->scolat * obs->slon;
+    obs->up[2]    = obs->ccolat;
+}
+
+void ecef2azel_observer(const double recef[3], const sgp4_observer_t *obs, double razel[3])
+{
+    double halfpi = pi * 0.5;
+    double small  = 0.00000001;
+    double rhoecef[3];
+    double tempvec[3];
+    double rhosez[3];
+    double temp, rho, az, el;
+    int i;
+    
+    for (i = 0; i < 3; i++)
+    {
+        rhoecef[i] = recef[i] - obs->rs[i];
+    }
+    rho = mag(rhoecef);
+    
+    //rot3 and rot2 with the cached trig
+    tempvec[1] = obs->clon*rhoecef[1] - obs->slon*rhoecef[0];
+    tempvec[0] = obs->clon*rhoecef[0] + obs->slon*rhoecef[1];
+    tempvec[2] = rhoecef[2];
+    rhosez[2] = obs->ccolat*tempvec[2] + obs->scolat*tempvec[0];
+    rhosez[0] = obs->ccolat*tempvec[0] - obs->scolat*tempvec[2];
+    rhosez[1] = tempvec[1];
+    
+    temp = sqrt(rhosez[0]*rhosez[0] + rhosez[1]*rhosez[1]);
+    if (temp < small)
+    {
+        el = sgn(rhosez[2]) * halfpi;
+        az = NAN;
+    }
+    else
+    {
+        el = asin(rhosez[2]/mag(rhosez));
+        az = atan2(rhosez[1], -rhosez[0]);
+    }
+    
+    razel[0] = rho;             //Range (km)
+    razel[1] = az;              //Azimuth (radians)
+    razel[2] = el;              //Elevation (radians)
+}
+
+void rv2azel_observer(const double ro[3], const sgp4_observer_t *obs, const sgp4_frame_t *frame, double razel[3])
+{
+    double recef[3];
+    
+    teme2ecef_frame(ro, frame, recef);
+    ecef2azel_observer(recef, obs, razel);
+}
+
+void ecef2azelrates_observer(const double recef[3], const double vecef[3], const sgp4_observer_t *obs, double razel[3], double razelrates[3])
+{
+    double halfpi = pi * 0.5;
+    double small  = 0.00000001;
+    double rhoecef[3];
+    double tempvec[3];
+    double rhosez[3];
+    double drhosez[3];
+    double temp, rho, az, el;
+    double drho, daz, del;
+    int i;
+    
+    for (i = 0; i < 3; i++)
+    {
+        rhoecef[i] = recef[i] - obs->rs[i];
+    }
+    rho = mag(rhoecef);
+    
+    //rot3 and rot2 with the cached trig, of the range vector and of its rate (the site is at rest in ECEF)
+    tempvec[1] = obs->clon*rhoecef[1] - obs->slon*rhoecef[0];
+    tempvec[0] = obs->clon*rhoecef[0] + obs->slon*rhoecef[1];
+    tempvec[2] = rhoecef[2];
+    rhosez[2] = obs->ccolat*tempvec[2] + obs->scolat*tempvec[0];
+    rhosez[0] = obs->ccolat*tempvec[0] - obs->scolat*tempvec[2];
+    rhosez[1] = tempvec[1];
+    
+    tempvec[1] = obs->clon*vecef[1] - obs->slon*vecef[0];
+    tempvec[0] = obs->clon*vecef[0] + obs->slon*vecef[1];
+    tempvec[2] = vecef[2];
+    drhosez[2] = obs->ccolat*tempvec[2] + obs->scolat*tempvec[0];
+    drhosez[0] = obs->ccolat*tempvec[0] - obs->scolat*tempvec[2];
+    drhosez[1] = tempvec[1];
+    
+    //Calculate azimuth, and elevation
+    temp = sqrt(rhosez[0]*rhosez[0] + rhosez[1]*rhosez[1]);
+    if (temp < small)
+    {
+        el = sgn(rhosez[2]) * halfpi;
+        az = atan2(drhosez[1], -drhosez[0]);
+    }
+    else
+    {
+        el = asin(rhosez[2]/mag(rhosez));
+        az = atan2(rhosez[1], -rhosez[0]);
+    }
+    
     //Calculate rates for range, azimuth, and elevation
-    /**
     drho = dot(rhosez,drhosez) / rho;
     
     if(fabs(temp*temp) > small)
@@ -349,15 +704,34 @@ void rv2azel(double ro[3], double latgd, double lon, double alt, double jdut1, d
     {
         del = 0.0;
     }
-    ***/
-    //Move values to output vectors
+    
     razel[0] = rho;             //Range (km)
     razel[1] = az;              //Azimuth (radians)
     razel[2] = el;              //Elevation (radians)
     
-    //razelrates[0] = drho;       //Range rate (km/s)
-    //razelrates[1] = daz;        //Azimuth rate (rad/s)
-    //razelrates[2] = del;        //Elevation rate (rad/s)
+    razelrates[0] = drho;       //Range rate (km/s)
+    razelrates[1] = daz;        //Azimuth rate (rad/s)
+    razelrates[2] = del;        //Elevation rate (rad/s)
+}
+
+void rv2azelrates_observer(const double ro[3], const double vo[3], const sgp4_observer_t *obs, const sgp4_frame_t *frame, double razel[3], double razelrates[3])
+{
+    double recef[3];
+    double vecef[3];
+    
+    teme2ecefv_frame(ro, vo, frame, recef, vecef);
+    ecef2azelrates_observer(recef, vecef, obs, razel, razelrates);
+}
+
+double sinel_observer(const double recef[3], const sgp4_observer_t *obs)
+{
+    double rho[3];
+    
+    rho[0] = recef[0] - obs->rs[0];
+    rho[1] = recef[1] - obs->rs[1];
+    rho[2] = recef[2] - obs->rs[2];
+    
+    return (rho[0]*obs->up[0] + rho[1]*obs->up[1] + rho[2]*obs->up[2]) / sqrt(rho[0]*rho[0] + rho[1]*rho[1] + rho[2]*rho[2]);
 }
 
 void rot3(double invec[3], double xval, double outvec[3])
@@ -382,6 +756,128 @@ void rot2(double invec[3], double xval, double outvec[3])
     outvec[1] = invec[1];
 }
 
+/*
+teme2eceff, sitef, rv2azelf
+
+Single precision versions of teme2ecef, site and rv2azel, for use with sgp4f.
+The sidereal time and the polar motion matrix are computed in double from the
+julian date and then rounded, since a float julian date only resolves a quarter
+of a day.
+*/
+
+static void rot3f(float invec[3], float xval, float outvec[3])
+{
+    float temp = invec[1];
+    float c = cosf(xval);
+    float s = sinf(xval);
+    
+    outvec[1] = c*invec[1] - s*invec[0];
+    outvec[0] = c*invec[0] + s*temp;
+    outvec[2] = invec[2];
+}
+
+static void rot2f(float invec[3], float xval, float outvec[3])
+{
+    float temp = invec[2];
+    float c = cosf(xval);
+    float s = sinf(xval);
+    
+    outvec[2] = c*invec[2] + s*invec[0];
+    outvec[0] = c*invec[0] - s*temp;
+    outvec[1] = invec[1];
+}
+
+void teme2eceff(float rteme[3], double jdut1, float recef[3])
+{
+    float gmst, cg, sg;
+    float rpef[3];
+    double pmd[3][3];
+    float pm[3][3];
+    int i, j;
+    
+    //Polar motion matrix, and Greenwich mean sidereal time of the UT1 date reduced to 0 to 2pi in double
+    gmst = (float)gstime(coord_eop(jdut1, pmd));
+    cg = cosf(gmst);
+    sg = sinf(gmst);
+    
+    //Pseudo earth fixed position vector, inverse pef-tod matrix times rteme
+    rpef[0] =  cg * rteme[0] + sg * rteme[1];
+    rpef[1] = -sg * rteme[0] + cg * rteme[1];
+    rpef[2] = rteme[2];
+    
+    for (i = 0; i < 3; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            pm[i][j] = (float)pmd[i][j];
+        }
+    }
+    
+    //ECEF postion vector is the inverse of the polar motion vector multiplied by rpef
+    recef[0] = pm[0][0] * rpef[0] + pm[1][0] * rpef[1] + pm[2][0] * rpef[2];
+    recef[1] = pm[0][1] * rpef[0] + pm[1][1] * rpef[1] + pm[2][1] * rpef[2];
+    recef[2] = pm[0][2] * rpef[0] + pm[1][2] * rpef[1] + pm[2][2] * rpef[2];
+}
+
+void sitef(float latgd, float lon, float alt, float rs[3])
+{
+    const float re = 6378.137f;             //radius of earth in km
+    const float eesqrd = 0.006694385000f;   //eccentricity of earth sqrd
+    float sinlat, cearth, rdel, rk;
+    
+    sinlat = sinf(latgd);
+    cearth = re / sqrtf( 1.0f - (eesqrd*sinlat*sinlat) );
+    rdel = (cearth + alt) * cosf(latgd);
+    rk = ((1.0f - eesqrd) * cearth + alt ) * sinlat;
+    
+    rs[0] = rdel * cosf( lon );
+    rs[1] = rdel * sinf( lon );
+    rs[2] = rk;
+}
+
+void rv2azelf(float ro[3], float latgd, float lon, float alt, double jdut1, float razel[3])
+{
+    const float halfpi = (float)(pi * 0.5);
+    const float small  = 0.00000001f;
+    float temp;
+    float rs[3];
+    float recef[3];
+    float rhoecef[3];
+    float tempvec[3];
+    float rhosez[3];
+    float rho, az, el;
+    int i;
+    
+    sitef(latgd, lon, alt, rs);
+    teme2eceff(ro, jdut1, recef);
+    
+    for (i = 0; i < 3; i++)
+    {
+        rhoecef[i] = recef[i] - rs[i];
+    }
+    rho = sqrtf(rhoecef[0]*rhoecef[0] + rhoecef[1]*rhoecef[1] + rhoecef[2]*rhoecef[2]);
+    
+    //Convert to SEZ (topocentric horizon coordinate system)
+    rot3f(rhoecef, lon, tempvec);
+    rot2f(tempvec, (halfpi-latgd), rhosez);
+    
+    temp = sqrtf(rhosez[0]*rhosez[0] + rhosez[1]*rhosez[1]);
+    if (temp < small)
+    {
+        el = rhosez[2] < 0.0f ? -halfpi : halfpi;
+        az = NAN;
+    }
+    else
+    {
+        el = asinf(rhosez[2] / sqrtf(temp*temp + rhosez[2]*rhosez[2]));
+        az = atan2f(rhosez[1], -rhosez[0]);
+    }
+    
+    razel[0] = rho;             //Range (km)
+    razel[1] = az;              //Azimuth (radians)
+    razel[2] = el;              //Elevation (radians)
+}
+
 /*
 getJulianFromUnix
 
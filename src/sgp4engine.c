@@ -0,0 +1,519 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Multithreaded propagation of a catalog implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4engine
+ * \{
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE         /* pthread_setaffinity_np */
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include <sgp4/sgp4engine.h>
+
+/* Estimated cost of a record, relative to one near earth propagation. Deep space records
+   cost about half as much again, and the resonance integrator adds a step per 720 minutes
+   it has to advance */
+#define ENGINE_COST_NEAR    1.0
+#define ENGINE_COST_DEEP    1.5
+#define ENGINE_COST_STEP    0.012
+
+/* Jobs of the threads */
+enum
+{
+    engine_load,
+    engine_run,
+    engine_exit
+};
+
+/* State of one thread, on its own cache line since other threads steal from its range */
+typedef struct
+{
+    _Alignas(64) atomic_uint_least64_t range;   /* Chunks left: first in the low half, end in the high half */
+    sgp4_engine_t *eng;
+    int index;
+    size_t nok, steals;
+} engineworker;
+
+static double engine_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static uint64_t engine_pack(size_t lo, size_t hi)
+{
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+}
+
+/* Cost of propagating a record to tsince, following the restart rule of dspace */
+static double engine_cost(const elsetrec *satrec, double tsince)
+{
+    double steps;
+
+    if (satrec->method != 'd')
+    {
+        return ENGINE_COST_NEAR;
+    }
+    if (satrec->irez == 0)
+    {
+        return ENGINE_COST_DEEP;
+    }
+
+    if ((satrec->atime == 0.0) || (tsince * satrec->atime <= 0.0) || (fabs(tsince) < fabs(satrec->atime)))
+    {
+        steps = fabs(tsince) / 720.0;
+    }
+    else
+    {
+        steps = (fabs(tsince) - fabs(satrec->atime)) / 720.0;
+    }
+
+    return ENGINE_COST_DEEP + ENGINE_COST_STEP * steps;
+}
+
+/* Cuts the partition of a thread into chunks of about the same cost and publishes them */
+static void engine_chunks(sgp4_engine_t *eng, engineworker *self)
+{
+    size_t lo = eng->first[self->index], hi = eng->first[self->index + 1];
+    size_t *bounds = &eng->bounds[(size_t)self->index * (SGP4_ENGINE_CHUNKS + 1)];
+    double total = 0.0, acc = 0.0, target;
+    size_t i, c = 1;
+
+    for(i = lo; i < hi; i++)
+    {
+        total += engine_cost(&eng->satrecs[i], (eng->jd - eng->satrecs[i].jdsatepoch) * 1440.0);
+    }
+    target = total / SGP4_ENGINE_CHUNKS;
+
+    bounds[0] = lo;
+    for(i = lo; (i < hi) && (c < SGP4_ENGINE_CHUNKS); i++)
+    {
+        acc += engine_cost(&eng->satrecs[i], (eng->jd - eng->satrecs[i].jdsatepoch) * 1440.0);
+        while ((c < SGP4_ENGINE_CHUNKS) && (acc >= c * target))
+        {
+            bounds[c++] = i + 1;
+        }
+    }
+    while (c <= SGP4_ENGINE_CHUNKS)
+    {
+        bounds[c++] = hi;
+    }
+
+    /* Release: a thief that sees the range also sees the bounds */
+    atomic_store_explicit(&self->range, engine_pack((size_t)self->index * SGP4_ENGINE_CHUNKS,
+                                                    (size_t)(self->index + 1) * SGP4_ENGINE_CHUNKS),
+                          memory_order_release);
+}
+
+/* Takes the first chunk of a range (owner) or the last one (thief) */
+static bool engine_take(engineworker *wk, bool steal, size_t *chunk)
+{
+    uint64_t range = atomic_load_explicit(&wk->range, memory_order_acquire);
+    size_t lo, hi;
+
+    for(;;)
+    {
+        lo = (size_t)(range & 0xFFFFFFFFu);
+        hi = (size_t)(range >> 32);
+        if (lo >= hi)
+        {
+            return false;
+        }
+        if (atomic_compare_exchange_weak_explicit(&wk->range, &range,
+                                                  steal ? engine_pack(lo, hi - 1) : engine_pack(lo + 1, hi),
+                                                  memory_order_acq_rel, memory_order_acquire))
+        {
+            *chunk = steal ? hi - 1 : lo;
+            return true;
+        }
+    }
+}
+
+/* Propagates the records of a chunk, like sgp4_batch */
+static void engine_chunk(sgp4_engine_t *eng, engineworker *self, size_t chunk)
+{
+    const size_t *bounds = &eng->bounds[(chunk / SGP4_ENGINE_CHUNKS) * (SGP4_ENGINE_CHUNKS + 1) +
+                                        chunk % SGP4_ENGINE_CHUNKS];
+    double r[3], v[3];
+    size_t i;
+
+    for(i = bounds[0]; i < bounds[1]; i++)
+    {
+        r[0] = r[1] = r[2] = NAN;
+        v[0] = v[1] = v[2] = NAN;
+
+        if (sgp4(eng->whichconst, &eng->satrecs[i], (eng->jd - eng->satrecs[i].jdsatepoch) * 1440.0, r, v))
+        {
+            self->nok++;
+        }
+
+        eng->out.x[i]     = r[0];
+        eng->out.y[i]     = r[1];
+        eng->out.z[i]     = r[2];
+        eng->out.vx[i]    = v[0];
+        eng->out.vy[i]    = v[1];
+        eng->out.vz[i]    = v[2];
+        eng->out.error[i] = eng->satrecs[i].error;
+    }
+}
+
+static void engine_work(sgp4_engine_t *eng, engineworker *self, int job)
+{
+    engineworker *workers = (engineworker *)eng->workers;
+    size_t lo = eng->first[self->index], hi = eng->first[self->index + 1], chunk;
+    int k;
+
+    if (job == engine_load)
+    {
+        /* First touch of the partition and its outputs from the thread that owns them */
+        memcpy(&eng->satrecs[lo], &eng->src[lo], (hi - lo) * sizeof(elsetrec));
+        memset(&eng->out.x[lo],     0, (hi - lo) * sizeof(double));
+        memset(&eng->out.y[lo],     0, (hi - lo) * sizeof(double));
+        memset(&eng->out.z[lo],     0, (hi - lo) * sizeof(double));
+        memset(&eng->out.vx[lo],    0, (hi - lo) * sizeof(double));
+        memset(&eng->out.vy[lo],    0, (hi - lo) * sizeof(double));
+        memset(&eng->out.vz[lo],    0, (hi - lo) * sizeof(double));
+        memset(&eng->out.error[lo], 0, (hi - lo) * sizeof(int));
+        return;
+    }
+
+    self->nok    = 0;
+    self->steals = 0;
+    engine_chunks(eng, self);
+
+    while (engine_take(self, false, &chunk))
+    {
+        engine_chunk(eng, self, chunk);
+    }
+    for(k = 1; k < eng->nthreads; k++)
+    {
+        while (engine_take(&workers[(self->index + k) % eng->nthreads], true, &chunk))
+        {
+            self->steals++;
+            engine_chunk(eng, self, chunk);
+        }
+    }
+}
+
+static void engine_pin(int index)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+
+    CPU_ZERO(&set);
+    CPU_SET((int)(index % ((ncpu > 0) ? ncpu : 1)), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)index;
+#endif
+}
+
+static void *engine_thread(void *arg)
+{
+    engineworker *self = (engineworker *)arg;
+    sgp4_engine_t *eng = self->eng;
+    unsigned long seen = 0;
+    int job;
+
+    if (eng->pin)
+    {
+        engine_pin(self->index);
+    }
+
+    for(;;)
+    {
+        pthread_mutex_lock(&eng->lock);
+        while (eng->generation == seen)
+        {
+            pthread_cond_wait(&eng->start, &eng->lock);
+        }
+        seen = eng->generation;
+        job  = eng->job;
+        pthread_mutex_unlock(&eng->lock);
+
+        if (job == engine_exit)
+        {
+            break;
+        }
+        engine_work(eng, self, job);
+
+        pthread_mutex_lock(&eng->lock);
+        if (--eng->running == 0)
+        {
+            pthread_cond_signal(&eng->done);
+        }
+        pthread_mutex_unlock(&eng->lock);
+    }
+
+    return NULL;
+}
+
+/* Runs a job on every thread, the calling one being thread 0 */
+static void engine_dispatch(sgp4_engine_t *eng, int job)
+{
+    pthread_mutex_lock(&eng->lock);
+    eng->job     = job;
+    eng->running = eng->nthreads - 1;
+    eng->generation++;
+    pthread_cond_broadcast(&eng->start);
+    pthread_mutex_unlock(&eng->lock);
+
+    if (job == engine_exit)
+    {
+        return;
+    }
+
+    engine_work(eng, &((engineworker *)eng->workers)[0], job);
+
+    pthread_mutex_lock(&eng->lock);
+    while (eng->running > 0)
+    {
+        pthread_cond_wait(&eng->done, &eng->lock);
+    }
+    pthread_mutex_unlock(&eng->lock);
+}
+
+/* Releases the catalog and the buffers */
+static void engine_unload(sgp4_engine_t *eng)
+{
+    free(eng->satrecs);
+    free(eng->out.x);
+    free(eng->out.y);
+    free(eng->out.z);
+    free(eng->out.vx);
+    free(eng->out.vy);
+    free(eng->out.vz);
+    free(eng->out.error);
+    eng->satrecs = NULL;
+    memset(&eng->out, 0, sizeof(eng->out));
+    eng->n = 0;
+}
+
+bool sgp4_engine_init(sgp4_engine_t *eng, int nthreads, bool pin)
+{
+    engineworker *workers;
+    int i;
+
+    memset(eng, 0, sizeof(*eng));
+
+    if (nthreads <= 0)
+    {
+        nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (nthreads < 1)
+    {
+        nthreads = 1;
+    }
+
+    workers      = (engineworker *)aligned_alloc(64, nthreads * sizeof(engineworker));
+    eng->first   = (size_t *)calloc(nthreads + 1, sizeof(size_t));
+    eng->bounds  = (size_t *)calloc((size_t)nthreads * (SGP4_ENGINE_CHUNKS + 1), sizeof(size_t));
+    eng->threads = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    if ((workers == NULL) || (eng->first == NULL) || (eng->bounds == NULL) || (eng->threads == NULL))
+    {
+        free(workers);
+        free(eng->first);
+        free(eng->bounds);
+        free(eng->threads);
+        return false;
+    }
+    for(i = 0; i < nthreads; i++)
+    {
+        atomic_init(&workers[i].range, 0);
+        workers[i].eng    = eng;
+        workers[i].index  = i;
+        workers[i].nok    = 0;
+        workers[i].steals = 0;
+    }
+    eng->workers = workers;
+    eng->pin     = pin;
+
+    pthread_mutex_init(&eng->lock, NULL);
+    pthread_cond_init(&eng->start, NULL);
+    pthread_cond_init(&eng->done, NULL);
+
+    /* Threads that fail to start leave the engine with fewer threads */
+    eng->nthreads = 1;
+    for(i = 1; i < nthreads; i++)
+    {
+        if (pthread_create(&eng->threads[eng->nthreads], NULL, engine_thread, &workers[eng->nthreads]) != 0)
+        {
+            break;
+        }
+        eng->nthreads++;
+    }
+
+    return true;
+}
+
+void sgp4_engine_free(sgp4_engine_t *eng)
+{
+    int i;
+
+    if (eng->workers == NULL)
+    {
+        return;
+    }
+
+    engine_dispatch(eng, engine_exit);
+    for(i = 1; i < eng->nthreads; i++)
+    {
+        pthread_join(eng->threads[i], NULL);
+    }
+
+    engine_unload(eng);
+    pthread_cond_destroy(&eng->done);
+    pthread_cond_destroy(&eng->start);
+    pthread_mutex_destroy(&eng->lock);
+    free(eng->workers);
+    free(eng->first);
+    free(eng->bounds);
+    free(eng->threads);
+    memset(eng, 0, sizeof(*eng));
+}
+
+bool sgp4_engine_load(sgp4_engine_t *eng, gravconsttype whichconst, const elsetrec satrecs[], size_t n)
+{
+    double total = 0.0, acc = 0.0;
+    size_t i;
+    int p = 1;
+
+    engine_unload(eng);
+    if (n > 0xFFFFFFFFu)
+    {
+        return false;
+    }
+
+    /* Left untouched here, so that each thread places its own partition */
+    eng->satrecs   = (elsetrec *)malloc(n * sizeof(elsetrec) + 1);
+    eng->out.x     = (double *)malloc(n * sizeof(double) + 1);
+    eng->out.y     = (double *)malloc(n * sizeof(double) + 1);
+    eng->out.z     = (double *)malloc(n * sizeof(double) + 1);
+    eng->out.vx    = (double *)malloc(n * sizeof(double) + 1);
+    eng->out.vy    = (double *)malloc(n * sizeof(double) + 1);
+    eng->out.vz    = (double *)malloc(n * sizeof(double) + 1);
+    eng->out.error = (int *)malloc(n * sizeof(int) + 1);
+    if ((eng->satrecs == NULL) || (eng->out.x == NULL) || (eng->out.y == NULL) || (eng->out.z == NULL) ||
+        (eng->out.vx == NULL) || (eng->out.vy == NULL) || (eng->out.vz == NULL) || (eng->out.error == NULL))
+    {
+        engine_unload(eng);
+        return false;
+    }
+    eng->whichconst = whichconst;
+    eng->n          = n;
+
+    /* Partitions of about the same cost at epoch */
+    for(i = 0; i < n; i++)
+    {
+        total += engine_cost(&satrecs[i], 0.0);
+    }
+    eng->first[0] = 0;
+    for(i = 0; (i < n) && (p < eng->nthreads); i++)
+    {
+        acc += engine_cost(&satrecs[i], 0.0);
+        while ((p < eng->nthreads) && (acc >= p * total / eng->nthreads))
+        {
+            eng->first[p++] = i + 1;
+        }
+    }
+    while (p <= eng->nthreads)
+    {
+        eng->first[p++] = n;
+    }
+
+    eng->src = satrecs;
+    engine_dispatch(eng, engine_load);
+    eng->src = NULL;
+
+    return true;
+}
+
+size_t sgp4_engine_run(sgp4_engine_t *eng, double jd)
+{
+    engineworker *workers = (engineworker *)eng->workers;
+    double start = engine_now();
+    int i;
+
+    eng->jd = jd;
+    for(i = 0; i < eng->nthreads; i++)
+    {
+        atomic_store_explicit(&workers[i].range, 0, memory_order_relaxed);
+    }
+    engine_dispatch(eng, engine_run);
+
+    eng->stats.nok    = 0;
+    eng->stats.steals = 0;
+    for(i = 0; i < eng->nthreads; i++)
+    {
+        eng->stats.nok    += workers[i].nok;
+        eng->stats.steals += workers[i].steals;
+    }
+    eng->stats.seconds = engine_now() - start;
+
+    return eng->stats.nok;
+}
+
+size_t sgp4_engine_sequence(sgp4_engine_t *eng, const double jds[], size_t ntimes, sgp4_engine_step_t step,
+                            void *arg)
+{
+    size_t k, nok = 0;
+
+    for(k = 0; k < ntimes; k++)
+    {
+        nok += sgp4_engine_run(eng, jds[k]);
+        if (step != NULL)
+        {
+            step(arg, k, jds[k], &eng->out);
+        }
+    }
+
+    return nok;
+}
+
+/** \} End of sgp4engine group */
@@ -0,0 +1,356 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Earth orientation parameters from IERS data implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4eop
+ * \{
+ */
+
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE 700   /* mkstemp, fchmod and fsync */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <sgp4/sgp4eop.h>
+
+#define SGP4_EOP_MAGIC      "SGPE"
+#define SGP4_EOP_VERSION    1
+#define SGP4_EOP_ENDIAN     0x01020304u     /* Reads back as 0x04030201 with the other byte order */
+
+#define EOP_PMUNIT      4.848136811095359936e-12    /* 1e-6 arcsec (rad) */
+#define EOP_DUT1UNIT    1e-7                        /* 1e-7 sec */
+#define EOP_LEAP        10000000                    /* 1 sec, in 1e-7 sec */
+
+#define EOP_LINE        256     /* Longest line read, the finals2000A lines are 187 characters */
+
+static const sgp4_eop_t *eop_current = NULL;
+
+/* Parses columns first to last of a finals line, inclusive and 1-based as in the IERS readme, false when blank */
+static bool eop_field(const char *line, size_t len, size_t first, size_t last, double *value)
+{
+    char buf[16];
+    char *end;
+    size_t n;
+
+    if (len < last)
+    {
+        return false;
+    }
+
+    n = last - first + 1;
+    memcpy(buf, line + first - 1, n);
+    buf[n] = '\0';
+
+    *value = strtod(buf, &end);
+    if (end == buf)
+    {
+        return false;
+    }
+    while (*end == ' ')
+    {
+        end++;
+    }
+
+    return *end == '\0';
+}
+
+/* Rounds a value to a number of units, false when it does not fit */
+static bool eop_units(double value, double unit, int32_t *out)
+{
+    double v = round(value / unit);
+
+    if (!(fabs(v) < 2147483647.0))
+    {
+        return false;
+    }
+    *out = (int32_t)v;
+
+    return true;
+}
+
+sgp4eopstatus sgp4_eop_load(const char *path, sgp4_eop_t *eop)
+{
+    char line[EOP_LINE];
+    sgp4_eop_entry_t *entries = NULL, *grown, entry;
+    size_t n = 0, cap = 0, len;
+    double mjd, xp, yp, dut1;
+    int32_t mjd0 = 0;
+    bool ok = true;
+    FILE *f;
+
+    memset(eop, 0, sizeof(*eop));
+
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        return eop_eio;
+    }
+
+    while (ok && (fgets(line, sizeof(line), f) != NULL))
+    {
+        len = strcspn(line, "\r\n");
+        line[len] = '\0';
+
+        /* MJD in columns 8-15, PM-x in 19-27 and PM-y in 38-46 (arcsec), UT1-UTC in 59-68 (sec) */
+        if (!eop_field(line, len, 8, 15, &mjd) || !eop_field(line, len, 19, 27, &xp) ||
+            !eop_field(line, len, 38, 46, &yp) || !eop_field(line, len, 59, 68, &dut1))
+        {
+            break;
+        }
+
+        if ((n == 0) && (mjd == floor(mjd)) && (fabs(mjd) < 1e9))
+        {
+            mjd0 = (int32_t)mjd;
+        }
+        ok = (mjd == (double)mjd0 + (double)n) &&
+             eop_units(xp, 1e-6, &entry.xp) && eop_units(yp, 1e-6, &entry.yp) && eop_units(dut1, EOP_DUT1UNIT, &entry.dut1);
+        if (!ok)
+        {
+            break;
+        }
+
+        if (n == cap)
+        {
+            cap = (cap == 0) ? 4096 : 2 * cap;
+            grown = realloc(entries, cap * sizeof(sgp4_eop_entry_t));
+            if (grown == NULL)
+            {
+                free(entries);
+                fclose(f);
+                return eop_enomem;
+            }
+            entries = grown;
+        }
+        entries[n++] = entry;
+    }
+
+    if (ferror(f))
+    {
+        free(entries);
+        fclose(f);
+        return eop_eio;
+    }
+    fclose(f);
+
+    if (!ok || (n < 2))
+    {
+        free(entries);
+        return eop_eformat;
+    }
+
+    eop->entries = entries;
+    eop->mjd0    = mjd0;
+    eop->n       = n;
+    eop->buf     = entries;
+
+    return eop_ok;
+}
+
+bool sgp4_eop_save(const char *path, const sgp4_eop_t *eop)
+{
+    sgp4_eop_header_t header;
+    char *tmp;
+    FILE *f;
+    bool ok;
+    int fd;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SGP4_EOP_MAGIC, 4);
+    header.version = SGP4_EOP_VERSION;
+    header.endian  = SGP4_EOP_ENDIAN;
+    header.entsize = sizeof(sgp4_eop_entry_t);
+    header.mjd0    = eop->mjd0;
+    header.count   = (uint32_t)eop->n;
+
+    /* Unique temporary name next to path, so concurrent saves never share it */
+    tmp = malloc(strlen(path) + 8);
+    if (tmp == NULL)
+    {
+        return false;
+    }
+    strcpy(tmp, path);
+    strcat(tmp, ".XXXXXX");
+
+    fd = mkstemp(tmp);
+    if (fd < 0)
+    {
+        free(tmp);
+        return false;
+    }
+    f = fdopen(fd, "wb");
+    if (f == NULL)
+    {
+        close(fd);
+        remove(tmp);
+        free(tmp);
+        return false;
+    }
+
+    ok = (fchmod(fd, 0644) == 0) &&     /* mkstemp creates it 0600 */
+         (fwrite(&header, sizeof(header), 1, f) == 1) &&
+         (fwrite(eop->entries, sizeof(sgp4_eop_entry_t), eop->n, f) == eop->n);
+    ok = ok && (fflush(f) == 0) && (fsync(fd) == 0);    /* Complete on disk before the rename */
+    ok = (fclose(f) == 0) && ok;
+    ok = ok && (rename(tmp, path) == 0);
+    if (!ok)
+    {
+        remove(tmp);
+    }
+    free(tmp);
+
+    return ok;
+}
+
+sgp4eopstatus sgp4_eop_open(const char *path, sgp4_eop_t *eop)
+{
+    const sgp4_eop_header_t *header;
+    struct stat st;
+    void *map;
+    int fd;
+
+    memset(eop, 0, sizeof(*eop));
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return eop_eio;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return eop_eio;
+    }
+    if ((size_t)st.st_size < sizeof(sgp4_eop_header_t))
+    {
+        close(fd);
+        return eop_eformat;
+    }
+
+    /* Read only and shared, so every process mapping the file uses the same pages */
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return eop_eio;
+    }
+
+    header = (const sgp4_eop_header_t *)map;
+    if ((memcmp(header->magic, SGP4_EOP_MAGIC, 4) != 0) || (header->version != SGP4_EOP_VERSION) ||
+        (header->endian != SGP4_EOP_ENDIAN) || (header->entsize != sizeof(sgp4_eop_entry_t)) ||
+        (header->count < 2) ||
+        ((size_t)st.st_size != sizeof(sgp4_eop_header_t) + (size_t)header->count * sizeof(sgp4_eop_entry_t)))
+    {
+        munmap(map, (size_t)st.st_size);
+        return eop_eformat;
+    }
+
+    eop->entries = (const sgp4_eop_entry_t *)((const char *)map + sizeof(sgp4_eop_header_t));
+    eop->mjd0    = header->mjd0;
+    eop->n       = (size_t)header->count;
+    eop->map     = map;
+    eop->maplen  = (size_t)st.st_size;
+
+    return eop_ok;
+}
+
+void sgp4_eop_close(sgp4_eop_t *eop)
+{
+    if (eop->map != NULL)
+    {
+        munmap(eop->map, eop->maplen);
+    }
+    free(eop->buf);
+    memset(eop, 0, sizeof(*eop));
+}
+
+bool sgp4_eop_get(const sgp4_eop_t *eop, double jd, double *xp, double *yp, double *dut1)
+{
+    const sgp4_eop_entry_t *a, *b;
+    double t = jd - 2400000.5 - (double)eop->mjd0;
+    double f;
+    int32_t d;
+    size_t i;
+
+    if ((eop->n < 2) || !(t >= 0.0) || !(t <= (double)(eop->n - 1)))
+    {
+        return false;
+    }
+
+    i = (size_t)t;
+    if (i == eop->n - 1)
+    {
+        i--;
+    }
+    f = t - (double)i;
+    a = &eop->entries[i];
+    b = &eop->entries[i + 1];
+
+    /* Leap second at the end of day i: interpolate without it */
+    d = b->dut1 - a->dut1;
+    if (d > EOP_LEAP / 2)
+    {
+        d -= EOP_LEAP;
+    }
+    else if (d < -EOP_LEAP / 2)
+    {
+        d += EOP_LEAP;
+    }
+
+    *xp   = (a->xp + f * (b->xp - a->xp)) * EOP_PMUNIT;
+    *yp   = (a->yp + f * (b->yp - a->yp)) * EOP_PMUNIT;
+    *dut1 = (a->dut1 + f * d) * EOP_DUT1UNIT;
+
+    return true;
+}
+
+void sgp4_eop_use(const sgp4_eop_t *eop)
+{
+    eop_current = eop;
+}
+
+const sgp4_eop_t *sgp4_eop_current(void)
+{
+    return eop_current;
+}
+
+/** \} End of sgp4eop group */
@@ -0,0 +1,640 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Single precision (float) propagation implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4float
+ * \{
+ */
+
+#include <math.h>
+
+#include <sgp4/sgp4float.h>
+
+#define pif     ((float)pi)
+#define twopif  ((float)(2.0 * pi))
+
+static float floatmodf(float a, float b)
+{
+    return a - b * floorf(a / b);
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure dpperf
+*
+*  single precision dpper for propagation (init = 'n').
+  --------------------------------------------------------------------------- */
+
+static void dpperf(const elsetrecf *satrec, float t, float *ep, float *inclp, float *nodep,
+                   float *argpp, float *mp, char opsmode)
+{
+    float alfdp, betdp, cosip, cosop, dalf, dbet, dls,
+          f2,    f3,    pe,    pgh,   ph,   pinc, pl ,
+          sel,   ses,   sghl,  sghs,  shll, shs,  sil,
+          sinip, sinop, sinzf, sis,   sll,  sls,  xls,
+          xnoh,  zf,    zm;
+
+    /* Constants */
+    const float zns = 1.19459e-5f;
+    const float zes = 0.01675f;
+    const float znl = 1.5835218e-4f;
+    const float zel = 0.05490f;
+
+    /* Calculate time varying periodics */
+    zm    = satrec->zmos + zns * t;
+    zf    = zm + 2.0f * zes * sinf(zm);
+    sinzf = sinf(zf);
+    f2    =  0.5f * sinzf * sinzf - 0.25f;
+    f3    = -0.5f * sinzf * cosf(zf);
+    ses   = satrec->se2 * f2 + satrec->se3 * f3;
+    sis   = satrec->si2 * f2 + satrec->si3 * f3;
+    sls   = satrec->sl2 * f2 + satrec->sl3 * f3 + satrec->sl4 * sinzf;
+    sghs  = satrec->sgh2 * f2 + satrec->sgh3 * f3 + satrec->sgh4 * sinzf;
+    shs   = satrec->sh2 * f2 + satrec->sh3 * f3;
+    zm    = satrec->zmol + znl * t;
+    zf    = zm + 2.0f * zel * sinf(zm);
+    sinzf = sinf(zf);
+    f2    =  0.5f * sinzf * sinzf - 0.25f;
+    f3    = -0.5f * sinzf * cosf(zf);
+    sel   = satrec->ee2 * f2 + satrec->e3 * f3;
+    sil   = satrec->xi2 * f2 + satrec->xi3 * f3;
+    sll   = satrec->xl2 * f2 + satrec->xl3 * f3 + satrec->xl4 * sinzf;
+    sghl  = satrec->xgh2 * f2 + satrec->xgh3 * f3 + satrec->xgh4 * sinzf;
+    shll  = satrec->xh2 * f2 + satrec->xh3 * f3;
+    pe    = ses + sel - satrec->peo;
+    pinc  = sis + sil - satrec->pinco;
+    pl    = sls + sll - satrec->plo;
+    pgh   = sghs + sghl - satrec->pgho;
+    ph    = shs + shll - satrec->pho;
+
+    *inclp = *inclp + pinc;
+    *ep    = *ep + pe;
+    sinip  = sinf(*inclp);
+    cosip  = cosf(*inclp);
+
+    /* sgp4fix for lyddane choice, gsfc version with perturbed inclination */
+    if (*inclp >= 0.2f)
+    {
+        ph     = ph / sinip;
+        pgh    = pgh - cosip * ph;
+        *argpp = *argpp + pgh;
+        *nodep = *nodep + ph;
+        *mp    = *mp + pl;
+    }
+    else
+    {
+        /* Apply periodics with lyddane modification */
+        sinop  = sinf(*nodep);
+        cosop  = cosf(*nodep);
+        alfdp  = sinip * sinop;
+        betdp  = sinip * cosop;
+        dalf   =  ph * cosop + pinc * cosip * sinop;
+        dbet   = -ph * sinop + pinc * cosip * cosop;
+        alfdp  = alfdp + dalf;
+        betdp  = betdp + dbet;
+        *nodep = floatmodf(*nodep, twopif);
+        /* sgp4fix for afspc written intrinsic functions */
+        if ((*nodep < 0.0f) && (opsmode == 'a'))
+        {
+            *nodep = *nodep + twopif;
+        }
+        xls    = *mp + *argpp + cosip * *nodep;
+        dls    = pl + pgh - pinc * *nodep * sinip;
+        xls    = xls + dls;
+        xnoh   = *nodep;
+        *nodep = atan2f(alfdp, betdp);
+        /* sgp4fix for afspc written intrinsic functions */
+        if ((*nodep < 0.0f) && (opsmode == 'a'))
+        {
+            *nodep = *nodep + twopif;
+        }
+        if (fabsf(xnoh - *nodep) > pif)
+        {
+            if (*nodep < xnoh)
+            {
+                *nodep = *nodep + twopif;
+            }
+            else
+            {
+                *nodep = *nodep - twopif;
+            }
+        }
+        *mp    = *mp + pl;
+        *argpp = xls - *mp - cosip * *nodep;
+    }
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure dspacef
+*
+*  single precision dspace. the resonance integrator state (atime, xli, xni)
+*    is kept in the record as in the double precision version.
+  --------------------------------------------------------------------------- */
+
+static void dspacef(elsetrecf *satrec, float t, float tc, float *em, float *argpm, float *inclm,
+                    float *mm, float *nodem, float *dndt, float *nm)
+{
+    int iretn;
+    float delt, ft, theta, x2li, x2omi, xl, xldot , xnddt, xndt, xomi;
+
+    const float fasx2 = 0.13130908f;
+    const float fasx4 = 2.8843198f;
+    const float fasx6 = 0.37448087f;
+    const float g22   = 5.7686396f;
+    const float g32   = 0.95240898f;
+    const float g44   = 1.8014998f;
+    const float g52   = 1.0508330f;
+    const float g54   = 4.4108898f;
+    const float rptim = 4.37526908801129966e-3f;    /* this equates to 7.29211514668855e-5 rad/sec */
+    const float stepp =    720.0f;
+    const float stepn =   -720.0f;
+    const float step2 = 259200.0f;
+
+    /* Calculate deep space resonance effects */
+    *dndt  = 0.0f;
+    theta  = floatmodf(satrec->gsto + tc * rptim, twopif);
+    *em    = *em + satrec->dedt * t;
+
+    *inclm = *inclm + satrec->didt * t;
+    *argpm = *argpm + satrec->domdt * t;
+    *nodem = *nodem + satrec->dnodt * t;
+    *mm    = *mm + satrec->dmdt * t;
+
+    /* - update resonances : numerical (euler-maclaurin) integration - */
+    ft = 0.0f;
+    if (satrec->irez != 0)
+    {
+        if ((satrec->atime == 0.0f) || (t * satrec->atime <= 0.0f) || (fabsf(t) < fabsf(satrec->atime)))
+        {
+            satrec->atime  = 0.0f;
+            satrec->xni    = satrec->no;
+            satrec->xli    = satrec->xlamo;
+        }
+        delt = t > 0.0f ? stepp : stepn;
+
+        iretn = 381;
+        while(iretn == 381)
+        {
+            /* ----------- near - synchronous resonance terms ------- */
+            if (satrec->irez != 2)
+            {
+                xndt  = satrec->del1 * sinf(satrec->xli - fasx2) +
+                        satrec->del2 * sinf(2.0f * (satrec->xli - fasx4)) +
+                        satrec->del3 * sinf(3.0f * (satrec->xli - fasx6));
+                xldot = satrec->xni + satrec->xfact;
+                xnddt = satrec->del1 * cosf(satrec->xli - fasx2) +
+                        2.0f * satrec->del2 * cosf(2.0f * (satrec->xli - fasx4)) +
+                        3.0f * satrec->del3 * cosf(3.0f * (satrec->xli - fasx6));
+                xnddt = xnddt * xldot;
+            }
+            else
+            {
+                /* --------- near - half-day resonance terms -------- */
+                xomi  = satrec->argpo + satrec->argpdot * satrec->atime;
+                x2omi = xomi + xomi;
+                x2li  = satrec->xli + satrec->xli;
+                xndt  = satrec->d2201 * sinf(x2omi + satrec->xli - g22) + satrec->d2211 * sinf(satrec->xli - g22) +
+                        satrec->d3210 * sinf(xomi + satrec->xli - g32)  + satrec->d3222 * sinf(-xomi + satrec->xli - g32) +
+                        satrec->d4410 * sinf(x2omi + x2li - g44)        + satrec->d4422 * sinf(x2li - g44) +
+                        satrec->d5220 * sinf(xomi + satrec->xli - g52)  + satrec->d5232 * sinf(-xomi + satrec->xli - g52) +
+                        satrec->d5421 * sinf(xomi + x2li - g54)         + satrec->d5433 * sinf(-xomi + x2li - g54);
+                xldot = satrec->xni + satrec->xfact;
+                xnddt = satrec->d2201 * cosf(x2omi + satrec->xli - g22) + satrec->d2211 * cosf(satrec->xli - g22) +
+                        satrec->d3210 * cosf(xomi + satrec->xli - g32)  + satrec->d3222 * cosf(-xomi + satrec->xli - g32) +
+                        satrec->d5220 * cosf(xomi + satrec->xli - g52)  + satrec->d5232 * cosf(-xomi + satrec->xli - g52) +
+                        2.0f * (satrec->d4410 * cosf(x2omi + x2li - g44) +
+                        satrec->d4422 * cosf(x2li - g44) + satrec->d5421 * cosf(xomi + x2li - g54) +
+                        satrec->d5433 * cosf(-xomi + x2li - g54));
+                xnddt = xnddt * xldot;
+            }
+
+            /* Integrator */
+            if (fabsf(t - satrec->atime) >= stepp)
+            {
+                satrec->xli   = satrec->xli + xldot * delt + xndt * step2;
+                satrec->xni   = satrec->xni + xndt * delt + xnddt * step2;
+                satrec->atime = satrec->atime + delt;
+            }
+            else /* exit here */
+            {
+                ft    = t - satrec->atime;
+                iretn = 0;
+            }
+        }
+
+        *nm = satrec->xni + xndt * ft + xnddt * ft * ft * 0.5f;
+        xl  = satrec->xli + xldot * ft + xndt * ft * ft * 0.5f;
+        if (satrec->irez != 1)
+        {
+            *mm = xl - 2.0f * *nodem + 2.0f * theta;
+        }
+        else
+        {
+            *mm = xl - *nodem - *argpm + theta;
+        }
+        *dndt = *nm - satrec->no;
+        *nm   = satrec->no + *dndt;
+    }
+}
+
+void elsetrec2f(const elsetrec *satrec, elsetrecf *satrecf)
+{
+    satrecf->satnum         = satrec->satnum;
+    satrecf->error          = satrec->error;
+    satrecf->operationmode  = satrec->operationmode;
+    satrecf->method         = satrec->method;
+
+    /* Near Earth */
+    satrecf->isimp      = satrec->isimp;
+    satrecf->aycof      = (float)satrec->aycof;
+    satrecf->con41      = (float)satrec->con41;
+    satrecf->cc1        = (float)satrec->cc1;
+    satrecf->cc4        = (float)satrec->cc4;
+    satrecf->cc5        = (float)satrec->cc5;
+    satrecf->d2         = (float)satrec->d2;
+    satrecf->d3         = (float)satrec->d3;
+    satrecf->d4         = (float)satrec->d4;
+    satrecf->delmo      = (float)satrec->delmo;
+    satrecf->eta        = (float)satrec->eta;
+    satrecf->argpdot    = (float)satrec->argpdot;
+    satrecf->omgcof     = (float)satrec->omgcof;
+    satrecf->sinmao     = (float)satrec->sinmao;
+    satrecf->t          = (float)satrec->t;
+    satrecf->t2cof      = (float)satrec->t2cof;
+    satrecf->t3cof      = (float)satrec->t3cof;
+    satrecf->t4cof      = (float)satrec->t4cof;
+    satrecf->t5cof      = (float)satrec->t5cof;
+    satrecf->x1mth2     = (float)satrec->x1mth2;
+    satrecf->x7thm1     = (float)satrec->x7thm1;
+    satrecf->mdot       = (float)satrec->mdot;
+    satrecf->nodedot    = (float)satrec->nodedot;
+    satrecf->xlcof      = (float)satrec->xlcof;
+    satrecf->xmcof      = (float)satrec->xmcof;
+    satrecf->nodecf     = (float)satrec->nodecf;
+
+    /* Deep Space */
+    satrecf->irez       = satrec->irez;
+    satrecf->d2201      = (float)satrec->d2201;
+    satrecf->d2211      = (float)satrec->d2211;
+    satrecf->d3210      = (float)satrec->d3210;
+    satrecf->d3222      = (float)satrec->d3222;
+    satrecf->d4410      = (float)satrec->d4410;
+    satrecf->d4422      = (float)satrec->d4422;
+    satrecf->d5220      = (float)satrec->d5220;
+    satrecf->d5232      = (float)satrec->d5232;
+    satrecf->d5421      = (float)satrec->d5421;
+    satrecf->d5433      = (float)satrec->d5433;
+    satrecf->dedt       = (float)satrec->dedt;
+    satrecf->del1       = (float)satrec->del1;
+    satrecf->del2       = (float)satrec->del2;
+    satrecf->del3       = (float)satrec->del3;
+    satrecf->didt       = (float)satrec->didt;
+    satrecf->dmdt       = (float)satrec->dmdt;
+    satrecf->dnodt      = (float)satrec->dnodt;
+    satrecf->domdt      = (float)satrec->domdt;
+    satrecf->e3         = (float)satrec->e3;
+    satrecf->ee2        = (float)satrec->ee2;
+    satrecf->peo        = (float)satrec->peo;
+    satrecf->pgho       = (float)satrec->pgho;
+    satrecf->pho        = (float)satrec->pho;
+    satrecf->pinco      = (float)satrec->pinco;
+    satrecf->plo        = (float)satrec->plo;
+    satrecf->se2        = (float)satrec->se2;
+    satrecf->se3        = (float)satrec->se3;
+    satrecf->sgh2       = (float)satrec->sgh2;
+    satrecf->sgh3       = (float)satrec->sgh3;
+    satrecf->sgh4       = (float)satrec->sgh4;
+    satrecf->sh2        = (float)satrec->sh2;
+    satrecf->sh3        = (float)satrec->sh3;
+    satrecf->si2        = (float)satrec->si2;
+    satrecf->si3        = (float)satrec->si3;
+    satrecf->sl2        = (float)satrec->sl2;
+    satrecf->sl3        = (float)satrec->sl3;
+    satrecf->sl4        = (float)satrec->sl4;
+    satrecf->gsto       = (float)satrec->gsto;
+    satrecf->xfact      = (float)satrec->xfact;
+    satrecf->xgh2       = (float)satrec->xgh2;
+    satrecf->xgh3       = (float)satrec->xgh3;
+    satrecf->xgh4       = (float)satrec->xgh4;
+    satrecf->xh2        = (float)satrec->xh2;
+    satrecf->xh3        = (float)satrec->xh3;
+    satrecf->xi2        = (float)satrec->xi2;
+    satrecf->xi3        = (float)satrec->xi3;
+    satrecf->xl2        = (float)satrec->xl2;
+    satrecf->xl3        = (float)satrec->xl3;
+    satrecf->xl4        = (float)satrec->xl4;
+    satrecf->xlamo      = (float)satrec->xlamo;
+    satrecf->zmol       = (float)satrec->zmol;
+    satrecf->zmos       = (float)satrec->zmos;
+    satrecf->atime      = 0.0f;     /* restart the float integrator from epoch */
+    satrecf->xli        = (float)satrec->xli;
+    satrecf->xni        = (float)satrec->xni;
+
+    satrecf->jdsatepoch = satrec->jdsatepoch;
+    satrecf->bstar      = (float)satrec->bstar;
+    satrecf->inclo      = (float)satrec->inclo;
+    satrecf->nodeo      = (float)satrec->nodeo;
+    satrecf->ecco       = (float)satrec->ecco;
+    satrecf->argpo      = (float)satrec->argpo;
+    satrecf->mo         = (float)satrec->mo;
+    satrecf->no         = (float)satrec->no;
+}
+
+bool sgp4initf(gravconsttype whichconst, char opsmode, const int satn, const double epoch, const double xbstar,
+               const double xecco, const double xargpo, const double xinclo, const double xmo, const double xno,
+               const double xnodeo, elsetrecf *satrec)
+{
+    elsetrec satrecd;
+    bool ok;
+
+    ok = sgp4init(whichconst, opsmode, satn, epoch, xbstar, xecco, xargpo, xinclo, xmo, xno, xnodeo, &satrecd);
+
+    /* sgp4init leaves jdsatepoch to twoline2rv */
+    satrecd.jdsatepoch = epoch + 2433281.5;
+
+    elsetrec2f(&satrecd, satrec);
+
+    return ok;
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure sgp4f
+*
+*  single precision transcription of sgp4. the kepler iteration stops at a
+*    tolerance of 1.0e-6, since the 1.0e-12 of the double version is below
+*    the resolution of float.
+  --------------------------------------------------------------------------- */
+
+bool sgp4f(gravconsttype whichconst, elsetrecf *satrec, float tsince, float r[3], float v[3])
+{
+    float am,       axnl,   aynl,   betal,  cosim , cnod,
+          cos2u,    coseo1, cosi,   cosip,  cosisq, cossu,  cosu,
+          delm,     delomg, em,     emsq,   ecose,  el2,    eo1 ,
+          ep,       esine,  argpm,  argpp,  argpdf, pl,     mrt = 0.0f,
+          mvt,      rdotl,  rl,     rvdot,  rvdotl, sinim,
+          sin2u,    sineo1, sini,   sinip,  sinsu,  sinu,
+          snod,     su,     t2,     t3,     t4,     tem5,   temp,
+          temp1,    temp2,  tempa,  tempe,  templ,  u,      ux,
+          uy,       uz,     vx,     vy,     vz,     inclm,  mm,
+          nm,       nodem,  xinc,   xincp,  xl,     xlm,    mp,
+          xmdf,     xmx,    xmy,    nodedf, xnode,  nodep,  dndt,
+          delmtemp, j2,     xke,    j3oj2,  radiusearthkm,  vkmpersec;
+    double tumind, mud, radiusearthkmd, xked, j2d, j3d, j4d, j3oj2d;
+    int ktr;
+
+    const float temp4 = 1.5e-12f;
+    const float x2o3  = 2.0f / 3.0f;
+
+    getgravconst(whichconst, &tumind, &mud, &radiusearthkmd, &xked, &j2d, &j3d, &j4d, &j3oj2d);
+    radiusearthkm = (float)radiusearthkmd;
+    xke           = (float)xked;
+    j2            = (float)j2d;
+    j3oj2         = (float)j3oj2d;
+    vkmpersec     = (float)(radiusearthkmd * xked / 60.0);
+
+    /* Clear sgp4 error flag */
+    satrec->t     = tsince;
+    satrec->error = 0;
+
+    /* Update for secular gravity and atmospheric drag */
+    xmdf    = satrec->mo + satrec->mdot * satrec->t;
+    argpdf  = satrec->argpo + satrec->argpdot * satrec->t;
+    nodedf  = satrec->nodeo + satrec->nodedot * satrec->t;
+    argpm   = argpdf;
+    mm      = xmdf;
+    t2      = satrec->t * satrec->t;
+    nodem   = nodedf + satrec->nodecf * t2;
+    tempa   = 1.0f - satrec->cc1 * satrec->t;
+    tempe   = satrec->bstar * satrec->cc4 * satrec->t;
+    templ   = satrec->t2cof * t2;
+
+    if (satrec->isimp != 1)
+    {
+        delomg   = satrec->omgcof * satrec->t;
+        delmtemp = 1.0f + satrec->eta * cosf(xmdf);
+        delm     = satrec->xmcof * (delmtemp * delmtemp * delmtemp - satrec->delmo);
+        temp     = delomg + delm;
+        mm       = xmdf + temp;
+        argpm    = argpdf - temp;
+        t3       = t2 * satrec->t;
+        t4       = t3 * satrec->t;
+        tempa    = tempa - satrec->d2 * t2 - satrec->d3 * t3 - satrec->d4 * t4;
+        tempe    = tempe + satrec->bstar * satrec->cc5 * (sinf(mm) - satrec->sinmao);
+        templ    = templ + satrec->t3cof * t3 + t4 * (satrec->t4cof + satrec->t * satrec->t5cof);
+    }
+
+    nm    = satrec->no;
+    em    = satrec->ecco;
+    inclm = satrec->inclo;
+    if (satrec->method == 'd')
+    {
+        dspacef(satrec, satrec->t, satrec->t, &em, &argpm, &inclm, &mm, &nodem, &dndt, &nm);
+    }
+
+    if (nm <= 0.0f)
+    {
+        satrec->error = 2;
+        return false;
+    }
+    am = powf((xke / nm), x2o3) * tempa * tempa;
+    nm = xke / powf(am, 1.5f);
+    em = em - tempe;
+
+    if ((em >= 1.0f) || (em < -0.001f))
+    {
+        satrec->error = 1;
+        return false;
+    }
+    if (em < 1.0e-6f)
+    {
+        em = 1.0e-6f;
+    }
+    mm     = mm + satrec->no * templ;
+    xlm    = mm + argpm + nodem;
+    emsq   = em * em;
+    temp   = 1.0f - emsq;
+
+    nodem  = floatmodf(nodem, twopif);
+    argpm  = floatmodf(argpm, twopif);
+    xlm    = floatmodf(xlm, twopif);
+    mm     = floatmodf(xlm - argpm - nodem, twopif);
+
+    /* Compute extra mean quantities */
+    sinim = sinf(inclm);
+    cosim = cosf(inclm);
+
+    /* Add lunar-solar periodics */
+    ep     = em;
+    xincp  = inclm;
+    argpp  = argpm;
+    nodep  = nodem;
+    mp     = mm;
+    sinip  = sinim;
+    cosip  = cosim;
+    if (satrec->method == 'd')
+    {
+        dpperf(satrec, satrec->t, &ep, &xincp, &nodep, &argpp, &mp, satrec->operationmode);
+        if (xincp < 0.0f)
+        {
+            xincp = -xincp;
+            nodep = nodep + pif;
+            argpp = argpp - pif;
+        }
+        if ((ep < 0.0f ) || ( ep > 1.0f))
+        {
+            satrec->error = 3;
+            return false;
+        }
+    }
+
+    /* Long period periodics */
+    if (satrec->method == 'd')
+    {
+        sinip =  sinf(xincp);
+        cosip =  cosf(xincp);
+        satrec->aycof = -0.5f * j3oj2 * sinip;
+        /* sgp4fix for divide by zero for xincp = 180 deg */
+        if (fabsf(cosip + 1.0f) > 1.5e-12f)
+        {
+            satrec->xlcof = -0.25f * j3oj2 * sinip * (3.0f + 5.0f * cosip) / (1.0f + cosip);
+        }
+        else
+        {
+            satrec->xlcof = -0.25f * j3oj2 * sinip * (3.0f + 5.0f * cosip) / temp4;
+        }
+    }
+    axnl = ep * cosf(argpp);
+    temp = 1.0f / (am * (1.0f - ep * ep));
+    aynl = ep * sinf(argpp) + temp * satrec->aycof;
+    xl   = mp + argpp + nodep + temp * satrec->xlcof * axnl;
+
+    /* Solve kepler's equation */
+    u    = floatmodf(xl - nodep, twopif);
+    eo1  = u;
+    tem5 = 9999.9f;
+    ktr  = 1;
+    while ((fabsf(tem5) >= 1.0e-6f) && (ktr <= 10))
+    {
+        sineo1 = sinf(eo1);
+        coseo1 = cosf(eo1);
+        tem5   = 1.0f - coseo1 * axnl - sineo1 * aynl;
+        tem5   = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+        if (fabsf(tem5) >= 0.95f)
+        {
+            tem5 = tem5 > 0.0f ? 0.95f : -0.95f;
+        }
+        eo1    = eo1 + tem5;
+        ktr    = ktr + 1;
+    }
+
+    /* Short period preliminary quantities */
+    ecose = axnl * coseo1 + aynl * sineo1;
+    esine = axnl * sineo1 - aynl * coseo1;
+    el2   = axnl * axnl + aynl * aynl;
+    pl    = am * (1.0f - el2);
+    if (pl < 0.0f)
+    {
+        satrec->error = 4;
+        return false;
+    }
+    else
+    {
+        rl     = am * (1.0f - ecose);
+        rdotl  = sqrtf(am) * esine / rl;
+        rvdotl = sqrtf(pl) / rl;
+        betal  = sqrtf(1.0f - el2);
+        temp   = esine / (1.0f + betal);
+        sinu   = am / rl * (sineo1 - aynl - axnl * temp);
+        cosu   = am / rl * (coseo1 - axnl + aynl * temp);
+        su     = atan2f(sinu, cosu);
+        sin2u  = (cosu + cosu) * sinu;
+        cos2u  = 1.0f - 2.0f * sinu * sinu;
+        temp   = 1.0f / pl;
+        temp1  = 0.5f * j2 * temp;
+        temp2  = temp1 * temp;
+
+        /* Update for short period periodics */
+        if (satrec->method == 'd')
+        {
+            cosisq = cosip * cosip;
+            satrec->con41  = 3.0f * cosisq - 1.0f;
+            satrec->x1mth2 = 1.0f - cosisq;
+            satrec->x7thm1 = 7.0f * cosisq - 1.0f;
+        }
+        mrt   = rl * (1.0f - 1.5f * temp2 * betal * satrec->con41) + 0.5f * temp1 * satrec->x1mth2 * cos2u;
+        su    = su - 0.25f * temp2 * satrec->x7thm1 * sin2u;
+        xnode = nodep + 1.5f * temp2 * cosip * sin2u;
+        xinc  = xincp + 1.5f * temp2 * cosip * sinip * cos2u;
+        mvt   = rdotl - nm * temp1 * satrec->x1mth2 * sin2u / xke;
+        rvdot = rvdotl + nm * temp1 * (satrec->x1mth2 * cos2u + 1.5f * satrec->con41) / xke;
+
+        /* Orientation vectors */
+        sinsu =  sinf(su);
+        cossu =  cosf(su);
+        snod  =  sinf(xnode);
+        cnod  =  cosf(xnode);
+        sini  =  sinf(xinc);
+        cosi  =  cosf(xinc);
+        xmx   = -snod * cosi;
+        xmy   =  cnod * cosi;
+        ux    =  xmx * sinsu + cnod * cossu;
+        uy    =  xmy * sinsu + snod * cossu;
+        uz    =  sini * sinsu;
+        vx    =  xmx * cossu - cnod * sinsu;
+        vy    =  xmy * cossu - snod * sinsu;
+        vz    =  sini * cossu;
+
+        /* Position and velocity (in km and km/sec) */
+        r[0] = (mrt * ux) * radiusearthkm;
+        r[1] = (mrt * uy) * radiusearthkm;
+        r[2] = (mrt * uz) * radiusearthkm;
+        v[0] = (mvt * ux + rvdot * vx) * vkmpersec;
+        v[1] = (mvt * uy + rvdot * vy) * vkmpersec;
+        v[2] = (mvt * uz + rvdot * vz) * vkmpersec;
+    }
+
+    /* sgp4fix for decaying satellites */
+    if (mrt < 1.0f)
+    {
+        satrec->error = 6;
+        return false;
+    }
+
+    return true;
+}
+
+/** \} End of sgp4float group */
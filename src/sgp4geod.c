@@ -0,0 +1,196 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Non iterative conversion from ECEF to geodetic coordinates implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4geod
+ * \{
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <sgp4/sgp4geod.h>
+#include <sgp4/sgp4simd.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define SGP4_GEOD_X86
+#endif
+
+/* Ellipsoid of ijk2ll and site */
+#define GEOD_A      6378.137                        /* Equatorial radius (km) */
+#define GEOD_E2     0.006694385000                  /* Eccentricity squared */
+#define GEOD_B      (GEOD_A * 0.9966471868218963)   /* Polar radius, a sqrt(1 - e^2) (km) */
+#define GEOD_EP2B   (GEOD_E2 / (1.0 - GEOD_E2) * GEOD_B)
+#define GEOD_E2A    (GEOD_E2 * GEOD_A)
+
+#define GEOD_PASSES 2       /* Bowring passes (see sgp4geod.h) */
+
+/* Bowring's formula, see sgp4geod.h */
+static void geod_point(double x, double y, double z, double *lat, double *lon, double *alt)
+{
+    double p, s, c, q, num = z, den = 1.0, sp = 0.0, cp = 1.0;
+    int k;
+
+    p = sqrt(x * x + y * y);
+
+    /* Reduced latitude of the first estimate */
+    s = z * GEOD_A;
+    c = p * GEOD_B;
+    q = 1.0 / sqrt(s * s + c * c);
+    s *= q;
+    c *= q;
+
+    for(k = 0; k < GEOD_PASSES; k++)
+    {
+        num = z + GEOD_EP2B * s * s * s;
+        den = p - GEOD_E2A * c * c * c;
+        q   = 1.0 / sqrt(num * num + den * den);
+        sp  = num * q;
+        cp  = den * q;
+
+        /* Reduced latitude of the new estimate */
+        s = GEOD_B * sp;
+        c = GEOD_A * cp;
+        q = 1.0 / sqrt(s * s + c * c);
+        s *= q;
+        c *= q;
+    }
+
+    *lat = atan2(num, den);
+    *lon = atan2(y, x);
+    if (*lon >= pi)
+    {
+        *lon -= 2.0 * pi;
+    }
+    *alt = p * cp + z * sp - GEOD_A * sqrt(1.0 - GEOD_E2 * sp * sp);
+}
+
+#ifdef SGP4_GEOD_X86
+
+/* SSE2, 2 lanes */
+typedef double geod_vd2 __attribute__((vector_size(16)));
+typedef long long geod_vl2 __attribute__((vector_size(16)));
+#define VD          geod_vd2
+#define VL          geod_vl2
+#define VW          2
+#define VFN(name)   name##_sse2
+#define VATTR       static inline __attribute__((always_inline, target("sse2")))
+#define VTARGET     static __attribute__((target("sse2")))
+#define VSQRT(x)    ((VD)_mm_sqrt_pd((__m128d)(x)))
+#include "sgp4geod_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+/* AVX2, 4 lanes */
+typedef double geod_vd4 __attribute__((vector_size(32)));
+typedef long long geod_vl4 __attribute__((vector_size(32)));
+#define VD          geod_vd4
+#define VL          geod_vl4
+#define VW          4
+#define VFN(name)   name##_avx2
+#define VATTR       static inline __attribute__((always_inline, target("avx2")))
+#define VTARGET     static __attribute__((target("avx2")))
+#define VSQRT(x)    ((VD)_mm256_sqrt_pd((__m256d)(x)))
+#include "sgp4geod_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+/* AVX-512, 8 lanes */
+typedef double geod_vd8 __attribute__((vector_size(64)));
+typedef long long geod_vl8 __attribute__((vector_size(64)));
+#define VD          geod_vd8
+#define VL          geod_vl8
+#define VW          8
+#define VFN(name)   name##_avx512
+#define VATTR       static inline __attribute__((always_inline, target("avx512f,avx512dq")))
+#define VTARGET     static __attribute__((target("avx512f,avx512dq")))
+#define VSQRT(x)    ((VD)_mm512_sqrt_pd((__m512d)(x)))
+#include "sgp4geod_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+#endif /* SGP4_GEOD_X86 */
+
+void ecef2geod(const double r[3], double latlongh[3])
+{
+    geod_point(r[0], r[1], r[2], &latlongh[0], &latlongh[1], &latlongh[2]);
+}
+
+void ecef2geod_batch(const double x[], const double y[], const double z[], size_t n, double lat[], double lon[],
+                     double alt[])
+{
+    size_t i = 0;
+
+    switch(sgp4_simd_detect())
+    {
+#ifdef SGP4_GEOD_X86
+        case simd_avx512:
+            i = geod_run_avx512(x, y, z, n, lat, lon, alt);
+            break;
+        case simd_avx2:
+            i = geod_run_avx2(x, y, z, n, lat, lon, alt);
+            break;
+        case simd_sse2:
+            i = geod_run_sse2(x, y, z, n, lat, lon, alt);
+            break;
+#endif /* SGP4_GEOD_X86 */
+        default:
+            break;
+    }
+
+    /* Remaining points, or all of them without SIMD */
+    for(; i < n; i++)
+    {
+        geod_point(x[i], y[i], z[i], &lat[i], &lon[i], &alt[i]);
+    }
+}
+
+/** \} End of sgp4geod group */
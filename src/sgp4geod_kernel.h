@@ -0,0 +1,104 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Geodetic conversion kernel for one instruction set.
+ *
+ * Vector transcription of geod_point in sgp4geod.c, one point per lane.
+ *
+ * This file is a template: it has no include guard and is included once per instruction set
+ * by sgp4geod.c, which must define before including it:
+ *
+ * - VD, VL, VFN(name) and VATTR, as described in sgp4vmath.h.
+ * - VW: number of lanes.
+ * - VTARGET: attributes of the non inlined entry point.
+ * - VSQRT(x): lane-wise square root.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4geod
+ * \{
+ */
+
+#include "sgp4vmath.h"
+
+/* Converts the leading multiple of VW points, returns how many were converted */
+VTARGET size_t VFN(geod_run)(const double x[], const double y[], const double z[], size_t n, double lat[],
+                             double lon[], double alt[])
+{
+    VD vx, vy, vz, p, s, c, q, num, den, sp, cp, vlat, vlon, valt;
+    size_t i;
+    int k;
+
+    for(i = 0; i + VW <= n; i += VW)
+    {
+        memcpy(&vx, x + i, sizeof(vx));
+        memcpy(&vy, y + i, sizeof(vy));
+        memcpy(&vz, z + i, sizeof(vz));
+
+        p = VSQRT(vx * vx + vy * vy);
+
+        /* Reduced latitude of the first estimate */
+        s = vz * GEOD_A;
+        c = p * GEOD_B;
+        q = 1.0 / VSQRT(s * s + c * c);
+        s = s * q;
+        c = c * q;
+
+        for(k = 0; k < GEOD_PASSES; k++)
+        {
+            num = vz + GEOD_EP2B * s * s * s;
+            den = p - GEOD_E2A * c * c * c;
+            q   = 1.0 / VSQRT(num * num + den * den);
+            sp  = num * q;
+            cp  = den * q;
+
+            s = GEOD_B * sp;
+            c = GEOD_A * cp;
+            q = 1.0 / VSQRT(s * s + c * c);
+            s = s * q;
+            c = c * q;
+        }
+
+        vlat = VFN(vatan2)(num, den);
+        vlon = VFN(vatan2)(vy, vx);
+        vlon = VFN(vsel)(vlon >= pi, vlon - 2.0 * pi, vlon);
+        valt = p * cp + vz * sp - GEOD_A * VSQRT(1.0 - GEOD_E2 * sp * sp);
+
+        memcpy(lat + i, &vlat, sizeof(vlat));
+        memcpy(lon + i, &vlon, sizeof(vlon));
+        memcpy(alt + i, &valt, sizeof(valt));
+    }
+
+    return i;
+}
+
+/** \} End of sgp4geod group */
@@ -0,0 +1,366 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Propagation of one satellite on a uniform time grid implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4grid
+ * \{
+ */
+
+#include <math.h>
+
+#include <sgp4/sgp4ext.h>
+#include <sgp4/sgp4grid.h>
+
+#define GRID_SMALL  1.0e-2  /* Largest angle rotated with the Taylor series (rad) */
+
+/* Sine and cosine of an angle advanced by a fixed increment per sample */
+typedef struct
+{
+    double s, c;        /* sin and cos of the angle at the current sample */
+    double ds, dc;      /* sin and cos of the increment */
+} gridangle;
+
+/* Seeds an angle a0 + rate * t, advancing by rate * step per sample */
+static void grid_seed(gridangle *a, double a0, double rate, double t, double step)
+{
+    a->s  = sin(a0 + rate * t);
+    a->c  = cos(a0 + rate * t);
+    a->ds = sin(rate * step);
+    a->dc = cos(rate * step);
+}
+
+/* Advances an angle by one sample */
+static void grid_next(gridangle *a)
+{
+    double s = a->s * a->dc + a->c * a->ds;
+
+    a->c = a->c * a->dc - a->s * a->ds;
+    a->s = s;
+}
+
+/* Rotates (s, c) = (sin a, cos a) to sin and cos of a + d, d being small */
+static void grid_rotate(double d, double s, double c, double *sd, double *cd)
+{
+    double sind, cosd, d2;
+
+    if (fabs(d) < GRID_SMALL)
+    {
+        d2   = d * d;
+        sind = d * (1.0 - d2 / 6.0 * (1.0 - d2 / 20.0));
+        cosd = 1.0 - d2 / 2.0 * (1.0 - d2 / 12.0 * (1.0 - d2 / 30.0));
+    }
+    else
+    {
+        sind = sin(d);
+        cosd = cos(d);
+    }
+
+    *sd = s * cosd + c * sind;
+    *cd = c * cosd - s * sind;
+}
+
+/* Writes sample i of the output, NAN when the propagation failed with error codes 1 to 4 */
+static void grid_store(sgp4_soa_t *out, size_t i, const double r[3], const double v[3], int error)
+{
+    bool ok = (error < 1) || (error > 4);   /* The decayed state of error 6 is kept, as by sgp4_batch */
+
+    out->x[i] = ok ? r[0] : NAN;
+    out->y[i] = ok ? r[1] : NAN;
+    out->z[i] = ok ? r[2] : NAN;
+    if (out->vx != NULL)
+    {
+        out->vx[i] = ok ? v[0] : NAN;
+        out->vy[i] = ok ? v[1] : NAN;
+        out->vz[i] = ok ? v[2] : NAN;
+    }
+    if (out->error != NULL)
+    {
+        out->error[i] = error;
+    }
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure grid_deep
+*
+*  this procedure propagates a deep space record sample by sample with sgp4_r.
+  --------------------------------------------------------------------------- */
+
+static size_t grid_deep(gravconsttype whichconst, const elsetrec *satrec, double tstart, double step,
+                        size_t count, sgp4_soa_t *out)
+{
+    sgp4_ctx_t ctx;
+    double r[3], v[3];
+    size_t i, nok = 0;
+
+    sgp4_ctx_init(&ctx);
+    for(i = 0; i < count; i++)
+    {
+        if (sgp4_r(whichconst, satrec, &ctx, tstart + i * step, r, v))
+        {
+            nok++;
+        }
+        grid_store(out, i, r, v, ctx.error);
+    }
+
+    return nok;
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure grid_near
+*
+*  this procedure is the near earth path of sgp4 for a sequence of equally
+*    spaced times. the expressions follow sgp4 term by term, except for the
+*    sines and cosines (recurrences and small rotations), the kepler seed and
+*    the drag free semi-major axis, which is computed once.
+  --------------------------------------------------------------------------- */
+
+static size_t grid_near(gravconsttype whichconst, const elsetrec *satrec, double tstart, double step,
+                        size_t count, sgp4_soa_t *out)
+{
+    double tumin, mu, radiusearthkm, xke, j2, j3, j4, j3oj2, vkmpersec;
+    double am,      axnl,   aynl,   betal,  cnod,   cos2u,  coseo1, cosi,
+           cosap,   cossu,  cosu,   cosio,  delm,   delomg, em,     ecose,
+           el2,     eo1,    esine,  argpm,  aoterm, pl,     mrt,    mvt,
+           rdotl,   rl,     rvdot,  rvdotl, sin2u,  sineo1, sini,   sinap,
+           sinio,   sinsu,  sinu,   sinmm,  snod,   t,      t2,     t3,
+           t4,      tem5,   temp,   temp1,  temp2,  tempa,  tempe,  templ,
+           u,       ux,     uy,     uz,     vx,     vy,     vz,     nm,
+           nodem,   xl,     xlm,    mm,     xmx,    xmy,    delmtemp, norm;
+    double off1 = 0.0, off2 = 0.0;  /* E - u of the two previous samples */
+    double r[3], v[3];
+    gridangle xmdf = {0}, mmdf = {0}, argpdf = {0}, nodedf = {0};   /* Seeded at i = 0 */
+    int ktr, nseed = 0, error;
+    bool full = (satrec->isimp != 1);
+    size_t i, nok = 0;
+
+    const double twopi = 2.0 * pi;
+    const double x2o3  = 2.0 / 3.0;
+
+    getgravconst(whichconst, &tumin, &mu, &radiusearthkm, &xke, &j2, &j3, &j4, &j3oj2);
+    vkmpersec = radiusearthkm * xke / 60.0;
+
+    /* nm is the mean motion of the record for near earth, so am only varies with tempa */
+    aoterm = pow((xke / satrec->no), x2o3);
+    sinio  = sin(satrec->inclo);
+    cosio  = cos(satrec->inclo);
+
+    for(i = 0; i < count; i++)
+    {
+        t = tstart + i * step;
+
+        /* Secular angles, mmdf and argpdf include the linear drag term delomg */
+        if (i % SGP4_GRID_RESEED == 0)
+        {
+            grid_seed(&xmdf, satrec->mo, satrec->mdot, t, step);
+            grid_seed(&mmdf, satrec->mo, satrec->mdot + (full ? satrec->omgcof : 0.0), t, step);
+            grid_seed(&argpdf, satrec->argpo, satrec->argpdot - (full ? satrec->omgcof : 0.0), t, step);
+            grid_seed(&nodedf, satrec->nodeo, satrec->nodedot, t, step);
+        }
+        else
+        {
+            grid_next(&xmdf);
+            grid_next(&mmdf);
+            grid_next(&argpdf);
+            grid_next(&nodedf);
+        }
+
+        error = 0;
+        mrt   = 0.0;
+
+        /* Update for secular gravity and atmospheric drag */
+        mm    = satrec->mo + satrec->mdot * t;
+        argpm = satrec->argpo + satrec->argpdot * t;
+        t2    = t * t;
+        nodem = satrec->nodeo + satrec->nodedot * t + satrec->nodecf * t2;
+        tempa = 1.0 - satrec->cc1 * t;
+        tempe = satrec->bstar * satrec->cc4 * t;
+        templ = satrec->t2cof * t2;
+        sinap = argpdf.s;
+        cosap = argpdf.c;
+
+        if (full)
+        {
+            delomg   = satrec->omgcof * t;
+            delmtemp = 1.0 + satrec->eta * xmdf.c;
+            delm     = satrec->xmcof * (delmtemp * delmtemp * delmtemp - satrec->delmo);
+            temp     = delomg + delm;
+            mm       = mm + temp;
+            argpm    = argpm - temp;
+            t3       = t2 * t;
+            t4       = t3 * t;
+            tempa    = tempa - satrec->d2 * t2 - satrec->d3 * t3 - satrec->d4 * t4;
+            grid_rotate(delm, mmdf.s, mmdf.c, &sinmm, &temp);
+            tempe    = tempe + satrec->bstar * satrec->cc5 * (sinmm - satrec->sinmao);
+            templ    = templ + satrec->t3cof * t3 + t4 * (satrec->t4cof + t * satrec->t5cof);
+            grid_rotate(-delm, argpdf.s, argpdf.c, &sinap, &cosap);
+        }
+
+        am = aoterm * tempa * tempa;
+        nm = xke / (am * sqrt(am));
+        em = satrec->ecco - tempe;
+
+        if ((em >= 1.0) || (em < -0.001))
+        {
+            error = 1;
+        }
+        else
+        {
+            if (em < 1.0e-6)
+            {
+                em = 1.0e-6;
+            }
+            mm    = mm + satrec->no * templ;
+            xlm   = mm + argpm + nodem;
+
+            nodem = floatmod(nodem, twopi);
+            argpm = floatmod(argpm, twopi);
+            xlm   = floatmod(xlm, twopi);
+            mm    = floatmod(xlm - argpm - nodem, twopi);
+
+            /* Long period periodics */
+            axnl = em * cosap;
+            temp = 1.0 / (am * (1.0 - em * em));
+            aynl = em * sinap + temp * satrec->aycof;
+            xl   = mm + argpm + nodem + temp * satrec->xlcof * axnl;
+
+            /* Solve kepler's equation, seeded from the previous samples */
+            u    = floatmod(xl - nodem, twopi);
+            eo1  = u + (nseed >= 2 ? 2.0 * off1 - off2 : off1);
+            tem5 = 9999.9;
+            ktr  = 1;
+            while ((fabs(tem5) >= 1.0e-12) && (ktr <= 10))
+            {
+                sineo1 = sin(eo1);
+                coseo1 = cos(eo1);
+                tem5   = 1.0 - coseo1 * axnl - sineo1 * aynl;
+                tem5   = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+                if (fabs(tem5) >= 0.95)
+                {
+                    tem5 = tem5 > 0.0 ? 0.95 : -0.95;
+                }
+                eo1 = eo1 + tem5;
+                ktr = ktr + 1;
+            }
+            off2  = off1;
+            off1  = eo1 - u;
+            nseed = nseed + 1;
+
+            /* Short period preliminary quantities */
+            ecose = axnl * coseo1 + aynl * sineo1;
+            esine = axnl * sineo1 - aynl * coseo1;
+            el2   = axnl * axnl + aynl * aynl;
+            pl    = am * (1.0 - el2);
+            if (pl < 0.0)
+            {
+                error = 4;
+            }
+            else
+            {
+                rl     = am * (1.0 - ecose);
+                rdotl  = sqrt(am) * esine / rl;
+                rvdotl = sqrt(pl) / rl;
+                betal  = sqrt(1.0 - el2);
+                temp   = esine / (1.0 + betal);
+                sinu   = am / rl * (sineo1 - aynl - axnl * temp);
+                cosu   = am / rl * (coseo1 - axnl + aynl * temp);
+                sin2u  = (cosu + cosu) * sinu;
+                cos2u  = 1.0 - 2.0 * sinu * sinu;
+                temp   = 1.0 / pl;
+                temp1  = 0.5 * j2 * temp;
+                temp2  = temp1 * temp;
+
+                /* Update for short period periodics */
+                mrt   = rl * (1.0 - 1.5 * temp2 * betal * satrec->con41) + 0.5 * temp1 * satrec->x1mth2 * cos2u;
+                mvt   = rdotl - nm * temp1 * satrec->x1mth2 * sin2u / xke;
+                rvdot = rvdotl + nm * temp1 * (satrec->x1mth2 * cos2u + 1.5 * satrec->con41) / xke;
+
+                /* Orientation vectors, the corrections to su, xnode and xinc are small rotations */
+                norm = 1.0 / sqrt(sinu * sinu + cosu * cosu);
+                grid_rotate(-0.25 * temp2 * satrec->x7thm1 * sin2u, sinu * norm, cosu * norm, &sinsu, &cossu);
+                grid_rotate(satrec->nodecf * t2 + 1.5 * temp2 * cosio * sin2u, nodedf.s, nodedf.c, &snod, &cnod);
+                grid_rotate(1.5 * temp2 * cosio * sinio * cos2u, sinio, cosio, &sini, &cosi);
+                xmx   = -snod * cosi;
+                xmy   =  cnod * cosi;
+                ux    =  xmx * sinsu + cnod * cossu;
+                uy    =  xmy * sinsu + snod * cossu;
+                uz    =  sini * sinsu;
+                vx    =  xmx * cossu - cnod * sinsu;
+                vy    =  xmy * cossu - snod * sinsu;
+                vz    =  sini * cossu;
+
+                /* Position and velocity (in km and km/sec) */
+                r[0] = (mrt * ux) * radiusearthkm;
+                r[1] = (mrt * uy) * radiusearthkm;
+                r[2] = (mrt * uz) * radiusearthkm;
+                v[0] = (mvt * ux + rvdot * vx) * vkmpersec;
+                v[1] = (mvt * uy + rvdot * vy) * vkmpersec;
+                v[2] = (mvt * uz + rvdot * vz) * vkmpersec;
+
+                /* sgp4fix for decaying satellites */
+                if (mrt < 1.0)
+                {
+                    error = 6;
+                }
+            }
+        }
+
+        if (error == 0)
+        {
+            nok++;
+        }
+        else
+        {
+            nseed = 0;  /* Restart the kepler seed after an error */
+            off1  = 0.0;
+        }
+        grid_store(out, i, r, v, error);
+    }
+
+    return nok;
+}
+
+size_t sgp4_grid(gravconsttype whichconst, const elsetrec *satrec, double tstart, double step, size_t count, sgp4_soa_t *out)
+{
+    if (satrec->method == 'd')
+    {
+        return grid_deep(whichconst, satrec, tstart, step, count, out);
+    }
+
+    return grid_near(whichconst, satrec, tstart, step, count, out);
+}
+
+/** \} End of sgp4grid group */
@@ -0,0 +1,467 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Pipelined ingest of a catalog implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4ingest
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include <sgp4/sgp4io.h>
+#include <sgp4/sgp4ingest.h>
+
+/* Bounded multi-producer multi-consumer queue of fixed size items (D. Vyukov). Each cell
+   has a sequence number telling whether it is free for the push of a given position or
+   holds the item of a given position, so pushes and pops only contend on head and tail */
+typedef struct
+{
+    _Alignas(64) atomic_size_t head;        /* Next position to pop */
+    _Alignas(64) atomic_size_t tail;        /* Next position to push */
+    _Alignas(64) atomic_size_t *seq;
+    unsigned char *items;
+    size_t size, mask;
+} ingestqueue;
+
+/* Entry on its way to an init thread */
+typedef struct
+{
+    size_t index;
+    sgp4_entry_t entry;
+} ingestread;
+
+/* Entry on its way to the publisher */
+typedef struct
+{
+    size_t index;
+    sgp4_entry_t entry;
+    elsetrec satrec;
+} ingestdone;
+
+/* Counters updated by the threads of a stage */
+typedef struct
+{
+    atomic_size_t count, failed, stalls;
+} ingestcount;
+
+/* Work shared by the threads of one call */
+typedef struct
+{
+    sgp4_reader_t *rd;
+    bool checksum;
+    char opsmode;
+    gravconsttype whichconst;
+    ingestqueue toinit, topublish;
+    atomic_bool readdone;       /* The reader pushed its last entry */
+    atomic_int active;          /* Init threads still running */
+    ingestcount read, init, publish;
+    double start, readend, initend;
+} ingestwork;
+
+static double ingest_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static bool queue_init(ingestqueue *q, size_t depth, size_t size)
+{
+    size_t i, n = 2;
+
+    while (n < depth)
+    {
+        n <<= 1;
+    }
+
+    q->seq   = (atomic_size_t *)malloc(n * sizeof(atomic_size_t));
+    q->items = (unsigned char *)malloc(n * size);
+    if ((q->seq == NULL) || (q->items == NULL))
+    {
+        free(q->seq);
+        free(q->items);
+        return false;
+    }
+
+    for(i = 0; i < n; i++)
+    {
+        atomic_init(&q->seq[i], i);
+    }
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+    q->size = size;
+    q->mask = n - 1;
+
+    return true;
+}
+
+static void queue_free(ingestqueue *q)
+{
+    free(q->seq);
+    free(q->items);
+}
+
+/* False when the queue is full */
+static bool queue_push(ingestqueue *q, const void *item)
+{
+    size_t pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t seq;
+    intptr_t dif;
+
+    for(;;)
+    {
+        seq = atomic_load_explicit(&q->seq[pos & q->mask], memory_order_acquire);
+        dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&q->tail, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (dif < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+        }
+    }
+
+    memcpy(q->items + (pos & q->mask) * q->size, item, q->size);
+    atomic_store_explicit(&q->seq[pos & q->mask], pos + 1, memory_order_release);
+
+    return true;
+}
+
+/* False when the queue is empty */
+static bool queue_pop(ingestqueue *q, void *item)
+{
+    size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t seq;
+    intptr_t dif;
+
+    for(;;)
+    {
+        seq = atomic_load_explicit(&q->seq[pos & q->mask], memory_order_acquire);
+        dif = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (dif == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&q->head, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (dif < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+        }
+    }
+
+    memcpy(item, q->items + (pos & q->mask) * q->size, q->size);
+    atomic_store_explicit(&q->seq[pos & q->mask], pos + q->mask + 1, memory_order_release);
+
+    return true;
+}
+
+static void ingest_add(atomic_size_t *counter)
+{
+    atomic_fetch_add_explicit(counter, 1, memory_order_relaxed);
+}
+
+/* Decodes and initializes an entry split by the reader */
+static void ingest_entry(const ingestwork *work, ingestdone *item)
+{
+    if (item->entry.status == tle_ok)
+    {
+        item->entry.status = twoline_init(item->entry.line1, item->entry.len1, item->entry.line2,
+                                          item->entry.len2, work->checksum, work->opsmode,
+                                          work->whichconst, &item->satrec);
+    }
+}
+
+/* Copies the counters of the stages */
+static void ingest_stats(ingestwork *work, sgp4_ingest_stats_t *stats)
+{
+    stats->read.count     = atomic_load_explicit(&work->read.count, memory_order_relaxed);
+    stats->read.stalls    = atomic_load_explicit(&work->read.stalls, memory_order_relaxed);
+    stats->init.count     = atomic_load_explicit(&work->init.count, memory_order_relaxed);
+    stats->init.failed    = atomic_load_explicit(&work->init.failed, memory_order_relaxed);
+    stats->init.stalls    = atomic_load_explicit(&work->init.stalls, memory_order_relaxed);
+    stats->publish.count  = atomic_load_explicit(&work->publish.count, memory_order_relaxed);
+    stats->publish.failed = atomic_load_explicit(&work->publish.failed, memory_order_relaxed);
+    stats->publish.stalls = atomic_load_explicit(&work->publish.stalls, memory_order_relaxed);
+}
+
+/* Reader stage: splits the catalog into entries */
+static void *ingest_reader(void *arg)
+{
+    ingestwork *work = (ingestwork *)arg;
+    ingestread item;
+
+    for(item.index = 0; sgp4_reader_next(work->rd, false, work->opsmode, work->whichconst, &item.entry, NULL);
+        item.index++)
+    {
+        while (!queue_push(&work->toinit, &item))
+        {
+            ingest_add(&work->read.stalls);
+            sched_yield();
+        }
+        ingest_add(&work->read.count);
+    }
+
+    work->readend = ingest_now() - work->start;
+    atomic_store_explicit(&work->readdone, true, memory_order_release);
+
+    return NULL;
+}
+
+/* Init stage: runs twoline_init on the entries until the reader is done */
+static void *ingest_worker(void *arg)
+{
+    ingestwork *work = (ingestwork *)arg;
+    ingestread in;
+    ingestdone out;
+    bool done;
+
+    for(;;)
+    {
+        /* Read before the pop: once done is seen, an empty queue stays empty */
+        done = atomic_load_explicit(&work->readdone, memory_order_acquire);
+        if (!queue_pop(&work->toinit, &in))
+        {
+            if (done)
+            {
+                break;
+            }
+            ingest_add(&work->init.stalls);
+            sched_yield();
+            continue;
+        }
+
+        out.index = in.index;
+        out.entry = in.entry;
+        ingest_entry(work, &out);
+        if (out.entry.status != tle_ok)
+        {
+            ingest_add(&work->init.failed);
+        }
+
+        while (!queue_push(&work->topublish, &out))
+        {
+            ingest_add(&work->init.stalls);
+            sched_yield();
+        }
+        ingest_add(&work->init.count);
+    }
+
+    /* The last init thread to finish closes the stage */
+    if (atomic_fetch_sub_explicit(&work->active, 1, memory_order_acq_rel) == 1)
+    {
+        work->initend = ingest_now() - work->start;
+    }
+
+    return NULL;
+}
+
+/* Publishes a record and refreshes the counters seen by the callback */
+static void ingest_publish(ingestwork *work, const ingestdone *item, sgp4_publish_t publish, void *arg,
+                           sgp4_ingest_stats_t *stats)
+{
+    if (item->entry.status != tle_ok)
+    {
+        ingest_add(&work->publish.failed);
+    }
+    if (stats != NULL)
+    {
+        ingest_stats(work, stats);
+    }
+    publish(arg, item->index, &item->entry, &item->satrec);
+    ingest_add(&work->publish.count);
+}
+
+/* All three stages in the calling thread, when the pipeline cannot be set up */
+static void ingest_serial(ingestwork *work, sgp4_publish_t publish, void *arg, sgp4_ingest_stats_t *stats)
+{
+    ingestdone item;
+
+    for(item.index = 0; sgp4_reader_next(work->rd, false, work->opsmode, work->whichconst, &item.entry, NULL);
+        item.index++)
+    {
+        ingest_add(&work->read.count);
+        ingest_entry(work, &item);
+        if (item.entry.status != tle_ok)
+        {
+            ingest_add(&work->init.failed);
+        }
+        ingest_add(&work->init.count);
+        ingest_publish(work, &item, publish, arg, stats);
+    }
+
+    work->readend = work->initend = ingest_now() - work->start;
+}
+
+size_t sgp4_ingest(sgp4_reader_t *rd, bool checksum, char opsmode, gravconsttype whichconst, int nthreads,
+                   size_t depth, sgp4_publish_t publish, void *arg, sgp4_ingest_stats_t *stats)
+{
+    ingestwork work;
+    ingestdone item;
+    pthread_t reader, *threads = NULL;
+    bool queues, done, pipeline = false;
+    int i, nstarted = 0;
+
+    memset(&work, 0, sizeof(work));
+    work.rd         = rd;
+    work.checksum   = checksum;
+    work.opsmode    = opsmode;
+    work.whichconst = whichconst;
+    work.start      = ingest_now();
+    atomic_init(&work.readdone, false);
+    atomic_init(&work.active, 0);
+
+    if (nthreads <= 0)
+    {
+        nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (nthreads < 1)
+    {
+        nthreads = 1;
+    }
+    if (depth == 0)
+    {
+        depth = SGP4_INGEST_DEPTH;
+    }
+
+    queues = queue_init(&work.toinit, depth, sizeof(ingestread));
+    if (queues && !queue_init(&work.topublish, depth, sizeof(ingestdone)))
+    {
+        queue_free(&work.toinit);
+        queues = false;
+    }
+
+    /* Init threads first, then the reader. Without either, everything runs in this thread */
+    if (queues)
+    {
+        threads = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    }
+    for(i = 0; (threads != NULL) && (i < nthreads); i++)
+    {
+        atomic_fetch_add_explicit(&work.active, 1, memory_order_relaxed);
+        if (pthread_create(&threads[nstarted], NULL, ingest_worker, &work) == 0)
+        {
+            nstarted++;
+        }
+        else
+        {
+            atomic_fetch_sub_explicit(&work.active, 1, memory_order_relaxed);
+        }
+    }
+    if (nstarted > 0)
+    {
+        pipeline = (pthread_create(&reader, NULL, ingest_reader, &work) == 0);
+        if (!pipeline)
+        {
+            atomic_store_explicit(&work.readdone, true, memory_order_release);
+        }
+    }
+
+    if (pipeline)
+    {
+        /* Publish stage */
+        for(;;)
+        {
+            done = (atomic_load_explicit(&work.active, memory_order_acquire) == 0);
+            if (!queue_pop(&work.topublish, &item))
+            {
+                if (done)
+                {
+                    break;
+                }
+                ingest_add(&work.publish.stalls);
+                sched_yield();
+                continue;
+            }
+            ingest_publish(&work, &item, publish, arg, stats);
+        }
+        pthread_join(reader, NULL);
+    }
+
+    for(i = 0; i < nstarted; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    if (queues)
+    {
+        queue_free(&work.toinit);
+        queue_free(&work.topublish);
+    }
+
+    if (!pipeline)
+    {
+        nstarted = 0;
+        ingest_serial(&work, publish, arg, stats);
+    }
+
+    if (stats != NULL)
+    {
+        ingest_stats(&work, stats);
+        stats->read.failed     = 0;
+        stats->read.seconds    = work.readend;
+        stats->init.seconds    = work.initend;
+        stats->publish.seconds = ingest_now() - work.start;
+        stats->nthreads        = (nstarted > 0) ? nstarted : 1;
+    }
+
+    return atomic_load(&work.publish.count) - atomic_load(&work.publish.failed);
+}
+
+/** \} End of sgp4ingest group */
@@ -27,6 +27,11 @@
 *                           original baseline
 *       ----------------------------------------------------------------      */
 
+#include <stdint.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <sgp4/sgp4io.h>
 #include "stdlib.h"
 
@@ -330,3 +335,310 @@ bool twoline_checksum(const char longstr[80])
 
     return false;
 }
+
+/* ----------- fast parser - decoders of the fixed columns ---------- */
+
+/* Exact powers of ten, so that m / 10^k is correctly rounded like atof */
+static const double tle_pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+                                   1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+/* Negative powers of ten for the exponents, the same values as pow(10.0, -e) in twoline2rv */
+static const double tle_pow10n[] = {1e0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9};
+
+/* Decodes a field of blanks, an optional sign, digits with an optional point and blanks */
+static bool tle_decimal(const char *p, int width, double *value)
+{
+    uint64_t m = 0;
+    int i = 0, ndigits = 0, nfrac = -1;
+    bool neg = false;
+
+    while ((i < width) && (p[i] == ' '))
+    {
+        i++;
+    }
+    if ((i < width) && ((p[i] == '-') || (p[i] == '+')))
+    {
+        neg = (p[i] == '-');
+        i++;
+    }
+    for(; i < width; i++)
+    {
+        if ((p[i] >= '0') && (p[i] <= '9'))
+        {
+            m = m * 10 + (uint64_t)(p[i] - '0');
+            ndigits++;
+            if (nfrac >= 0)
+            {
+                nfrac++;
+            }
+        }
+        else if ((p[i] == '.') && (nfrac < 0))
+        {
+            nfrac = 0;
+        }
+        else
+        {
+            break;
+        }
+    }
+    while ((i < width) && (p[i] == ' '))
+    {
+        i++;
+    }
+
+    if ((i < width) || (ndigits == 0) || (ndigits > 18))
+    {
+        return false;
+    }
+
+    *value = (nfrac > 0) ? (double)m / tle_pow10[nfrac] : (double)m;
+    if (neg)
+    {
+        *value = -*value;
+    }
+
+    return true;
+}
+
+/* Decodes an unsigned integer field of digits, with leading blanks */
+static bool tle_integer(const char *p, int width, long *value)
+{
+    int i = 0;
+
+    *value = 0;
+    while ((i < width) && (p[i] == ' '))
+    {
+        i++;
+    }
+    if (i == width)
+    {
+        return false;
+    }
+    for(; i < width; i++)
+    {
+        if ((p[i] < '0') || (p[i] > '9'))
+        {
+            return false;
+        }
+        *value = *value * 10 + (p[i] - '0');
+    }
+
+    return true;
+}
+
+/* Decodes a 5 column catalog number, with the Alpha-5 letter (A = 10 ... Z = 33, no I and O) in the first column */
+static bool tle_satnum(const char *p, long *satnum)
+{
+    long first;
+
+    if ((p[0] >= 'A') && (p[0] <= 'Z') && (p[0] != 'I') && (p[0] != 'O'))
+    {
+        first = 10 + (p[0] - 'A') - (p[0] > 'I') - (p[0] > 'O');
+        if (!tle_integer(&p[1], 4, satnum) || (p[1] == ' '))
+        {
+            return false;
+        }
+        *satnum += first * 10000;
+        return true;
+    }
+
+    return tle_integer(p, 5, satnum);
+}
+
+/* Decodes an implied decimal point field with exponent, such as " 28098-4" for 0.28098e-4 */
+static bool tle_exponent(const char *p, double *value)
+{
+    uint64_t m = 0;
+    int i, e;
+
+    if ((p[0] != ' ') && (p[0] != '-') && (p[0] != '+'))
+    {
+        return false;
+    }
+    for(i = 1; i <= 5; i++)
+    {
+        if (p[i] == ' ')    /* Blank digits read as zeros, as in twoline2rv */
+        {
+            m = m * 10;
+        }
+        else if ((p[i] >= '0') && (p[i] <= '9'))
+        {
+            m = m * 10 + (uint64_t)(p[i] - '0');
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (((p[6] != ' ') && (p[6] != '-') && (p[6] != '+')) || ((p[7] != ' ') && ((p[7] < '0') || (p[7] > '9'))))
+    {
+        return false;
+    }
+
+    e = (p[7] == ' ') ? 0 : p[7] - '0';     /* A blank exponent reads as 0, as in twoline2rv */
+    *value = (double)m / 1e5;
+    *value = *value * ((p[6] == '-') ? tle_pow10n[e] : tle_pow10[e]);
+    if (p[0] == '-')
+    {
+        *value = -*value;
+    }
+
+    return true;
+}
+
+/* Checksum of the first 68 columns: sum of the digits plus one per minus sign, modulo 10 */
+static bool tle_checksum(const char *line)
+{
+    unsigned int cks = 0, d;
+    int i = 0;
+
+#if defined(__SSE2__)
+    /* 16 columns at a time: digit values and minus signs as bytes, summed with psadbw */
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i one   = _mm_set1_epi8(1);
+    __m128i sum = zero, c, digit;
+
+    for(; i + 16 <= 68; i += 16)
+    {
+        c     = _mm_loadu_si128((const __m128i *)&line[i]);
+        digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+        c     = _mm_add_epi8(_mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+                             _mm_and_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('-')), one));
+        sum   = _mm_add_epi64(sum, _mm_sad_epu8(c, zero));
+    }
+    cks = (unsigned int)(_mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8)));
+#endif
+
+    for(; i < 68; i++)
+    {
+        d    = (unsigned char)line[i] - '0';
+        cks += (d < 10) ? d : (line[i] == '-');
+    }
+
+    return (char)('0' + cks % 10) == line[68];
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           function twoline_parse
+*
+*  this function decodes a two line element set without modifying it. the
+*    fixed columns are decoded in place, the exponents come from a table of
+*    powers of ten and the epoch is built straight from the year and day of
+*    year. the elements are converted to the sgp4 units as in twoline2rv.
+*
+*  inputs        :
+*    line1, len1 - first line of the tle and its length
+*    line2, len2 - second line of the tle and its length
+*    checksum    - check the checksum of both lines
+*    whichconst  - which set of constants to use  wgs72old, wgs72, wgs84
+*
+*  outputs       :
+*    satrec      - satnum, epoch and mean elements
+*    tlestatus   - tle_ok, tle_eformat or tle_echecksum
+*
+*  coupling      :
+*    getgravconst-
+  --------------------------------------------------------------------------- */
+
+tlestatus twoline_parse(const char *line1, size_t len1, const char *line2, size_t len2, bool checksum,
+                        gravconsttype whichconst, elsetrec *satrec)
+{
+    const double deg2rad = pi / 180.0;
+    const double xpdotp  = 1440.0 / (2.0 * pi);
+
+    double tumin, mu, radiusearthkm, xke, j2, j3, j4, j3oj2;
+    double ecco;
+    long satnum2, epochyr, ecc;
+    int year;
+
+    if ((len1 < 69) || (len2 < 69) || (line1[0] != '1') || (line1[1] != ' ') || (line2[0] != '2') || (line2[1] != ' '))
+    {
+        return tle_eformat;
+    }
+    if (checksum && (!tle_checksum(line1) || !tle_checksum(line2)))
+    {
+        return tle_echecksum;
+    }
+
+    if (!tle_satnum(&line1[2], &satrec->satnum) || !tle_satnum(&line2[2], &satnum2) || (satnum2 != satrec->satnum) ||
+        !tle_integer(&line1[18], 2, &epochyr) || !tle_decimal(&line1[20], 12, &satrec->epochdays) ||
+        !tle_decimal(&line1[33], 10, &satrec->ndot) || !tle_exponent(&line1[44], &satrec->nddot) ||
+        !tle_exponent(&line1[53], &satrec->bstar) ||
+        !tle_decimal(&line2[8], 8, &satrec->inclo) || !tle_decimal(&line2[17], 8, &satrec->nodeo) ||
+        !tle_integer(&line2[26], 7, &ecc) || !tle_decimal(&line2[34], 8, &satrec->argpo) ||
+        !tle_decimal(&line2[43], 8, &satrec->mo) || !tle_decimal(&line2[52], 11, &satrec->no))
+    {
+        return tle_eformat;
+    }
+    ecco = (double)ecc / 1e7;
+
+    getgravconst(whichconst, &tumin, &mu, &radiusearthkm, &xke, &j2, &j3, &j4, &j3oj2);
+
+    satrec->error   = 0;
+    satrec->epochyr = (int)epochyr;
+    satrec->ecco    = ecco;
+
+    /* Find no, ndot, nddot */
+    satrec->no    = satrec->no / xpdotp;    /* rad/min */
+
+    /* Convert to sgp4 units */
+    satrec->a     = pow(satrec->no * tumin, (-2.0 / 3.0));
+    satrec->ndot  = satrec->ndot  / (xpdotp * 1440.0);
+    satrec->nddot = satrec->nddot / (xpdotp * 1440.0 * 1440);
+
+    /* Find standard orbital elements */
+    satrec->inclo = satrec->inclo * deg2rad;
+    satrec->nodeo = satrec->nodeo * deg2rad;
+    satrec->argpo = satrec->argpo * deg2rad;
+    satrec->mo    = satrec->mo    * deg2rad;
+
+    satrec->alta = satrec->a * (1.0 + satrec->ecco) - 1.0;
+    satrec->altp = satrec->a * (1.0 - satrec->ecco) - 1.0;
+
+    /* Julian date of 0 jan 0h of the year (jday with mon 1 and day 0), plus the day of year. Years from 1957 to 2056 */
+    year = (epochyr < 57) ? (int)epochyr + 2000 : (int)epochyr + 1900;
+    satrec->jdsatepoch = 367.0 * year - floor(7 * year * 0.25) + 30.0 + 1721013.5 + satrec->epochdays;
+
+    return tle_ok;
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           function twoline_init
+*
+*  this function decodes a two line element set with twoline_parse and
+*    initializes the sgp4 variables. the lines are not modified.
+*
+*  outputs       :
+*    satrec      - structure containing all the sgp4 satellite information
+*    tlestatus   - tle_ok, tle_eformat, tle_echecksum or tle_einit (the sgp4init
+*                  error code is in satrec->error)
+*
+*  coupling      :
+*    twoline_parse-
+*    sgp4init    - initialize the sgp4 variables
+  --------------------------------------------------------------------------- */
+
+tlestatus twoline_init(const char *line1, size_t len1, const char *line2, size_t len2, bool checksum,
+                       char opsmode, gravconsttype whichconst, elsetrec *satrec)
+{
+    tlestatus status;
+
+    status = twoline_parse(line1, len1, line2, len2, checksum, whichconst, satrec);
+    if (status != tle_ok)
+    {
+        return status;
+    }
+
+    /* sgp4init reports failures in satrec->error only */
+    sgp4init(whichconst, opsmode, satrec->satnum, satrec->jdsatepoch - 2433281.5, satrec->bstar,
+             satrec->ecco, satrec->argpo, satrec->inclo, satrec->mo, satrec->no,
+             satrec->nodeo, satrec);
+    if (satrec->error != 0)
+    {
+        return tle_einit;
+    }
+
+    return tle_ok;
+}
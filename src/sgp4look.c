@@ -0,0 +1,272 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Look angles from a network of observers to a catalog implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4look
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <sgp4/sgp4look.h>
+#include <sgp4/sgp4simd.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define SGP4_LOOK_X86
+#endif
+
+#define LOOK_SMALL  0.00000001  /* Horizontal range below which the azimuth is undefined (km), as in rv2azel */
+#define LOOK_CHUNK  256         /* Satellites per block of the sparse output */
+
+/* ecef2azel_observer, with the elevation as an arc tangent */
+static void look_point(const sgp4_observer_t *obs, double x, double y, double z, double *range, double *az,
+                       double *el)
+{
+    double rx = x - obs->rs[0], ry = y - obs->rs[1], rz = z - obs->rs[2];
+    double t0, s, e, u, h;
+
+    t0 = obs->clon * rx + obs->slon * ry;
+    s  = obs->ccolat * t0 - obs->scolat * rz;
+    e  = obs->clon * ry - obs->slon * rx;
+    u  = obs->ccolat * rz + obs->scolat * t0;
+    h  = sqrt(s * s + e * e);
+
+    *range = sqrt(rx * rx + ry * ry + rz * rz);
+    *el    = atan2(u, h);
+    *az    = (h < LOOK_SMALL) ? NAN : atan2(e, -s);
+}
+
+#ifdef SGP4_LOOK_X86
+
+/* SSE2, 2 lanes */
+typedef double look_vd2 __attribute__((vector_size(16)));
+typedef long long look_vl2 __attribute__((vector_size(16)));
+#define VD          look_vd2
+#define VL          look_vl2
+#define VW          2
+#define VFN(name)   name##_sse2
+#define VATTR       static inline __attribute__((always_inline, target("sse2")))
+#define VTARGET     static __attribute__((target("sse2")))
+#define VSQRT(x)    ((VD)_mm_sqrt_pd((__m128d)(x)))
+#include "sgp4look_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+/* AVX2, 4 lanes */
+typedef double look_vd4 __attribute__((vector_size(32)));
+typedef long long look_vl4 __attribute__((vector_size(32)));
+#define VD          look_vd4
+#define VL          look_vl4
+#define VW          4
+#define VFN(name)   name##_avx2
+#define VATTR       static inline __attribute__((always_inline, target("avx2")))
+#define VTARGET     static __attribute__((target("avx2")))
+#define VSQRT(x)    ((VD)_mm256_sqrt_pd((__m256d)(x)))
+#include "sgp4look_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+/* AVX-512, 8 lanes */
+typedef double look_vd8 __attribute__((vector_size(64)));
+typedef long long look_vl8 __attribute__((vector_size(64)));
+#define VD          look_vd8
+#define VL          look_vl8
+#define VW          8
+#define VFN(name)   name##_avx512
+#define VATTR       static inline __attribute__((always_inline, target("avx512f,avx512dq")))
+#define VTARGET     static __attribute__((target("avx512f,avx512dq")))
+#define VSQRT(x)    ((VD)_mm512_sqrt_pd((__m512d)(x)))
+#include "sgp4look_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+#endif /* SGP4_LOOK_X86 */
+
+/* Look angles from one observer to n satellites */
+static void look_row(sgp4simdtype isa, const sgp4_observer_t *obs, const double x[], const double y[],
+                     const double z[], size_t n, double range[], double az[], double el[])
+{
+    size_t i = 0;
+
+    switch(isa)
+    {
+#ifdef SGP4_LOOK_X86
+        case simd_avx512:
+            i = look_run_avx512(obs, x, y, z, n, range, az, el);
+            break;
+        case simd_avx2:
+            i = look_run_avx2(obs, x, y, z, n, range, az, el);
+            break;
+        case simd_sse2:
+            i = look_run_sse2(obs, x, y, z, n, range, az, el);
+            break;
+#endif /* SGP4_LOOK_X86 */
+        default:
+            break;
+    }
+
+    for(; i < n; i++)
+    {
+        look_point(obs, x[i], y[i], z[i], &range[i], &az[i], &el[i]);
+    }
+}
+
+/* ECEF positions of the satellites, in one buffer of 3 n values */
+static double *look_rotate(const sgp4_frame_t *frame, const sgp4_soa_t *teme, size_t n, sgp4_soa_t *ecef)
+{
+    double *buf = (double *)malloc(3 * n * sizeof(double) + 1);
+
+    if (buf == NULL)
+    {
+        return NULL;
+    }
+
+    memset(ecef, 0, sizeof(*ecef));
+    ecef->x = buf;
+    ecef->y = buf + n;
+    ecef->z = buf + 2 * n;
+    sgp4_look_ecef(frame, teme, n, ecef);
+
+    return buf;
+}
+
+void sgp4_look_ecef(const sgp4_frame_t *frame, const sgp4_soa_t *teme, size_t n, sgp4_soa_t *ecef)
+{
+    const double (*st)[3] = frame->st;
+    const double (*pm)[3] = frame->pm;
+    double rpef[3];
+    size_t i;
+
+    /* Same operations as teme2ecef_frame */
+    for(i = 0; i < n; i++)
+    {
+        rpef[0] = st[0][0] * teme->x[i] + st[1][0] * teme->y[i] + st[2][0] * teme->z[i];
+        rpef[1] = st[0][1] * teme->x[i] + st[1][1] * teme->y[i] + st[2][1] * teme->z[i];
+        rpef[2] = st[0][2] * teme->x[i] + st[1][2] * teme->y[i] + st[2][2] * teme->z[i];
+
+        ecef->x[i] = pm[0][0] * rpef[0] + pm[1][0] * rpef[1] + pm[2][0] * rpef[2];
+        ecef->y[i] = pm[0][1] * rpef[0] + pm[1][1] * rpef[1] + pm[2][1] * rpef[2];
+        ecef->z[i] = pm[0][2] * rpef[0] + pm[1][2] * rpef[1] + pm[2][2] * rpef[2];
+    }
+}
+
+bool sgp4_look_matrix(const sgp4_observer_t obs[], size_t m, const sgp4_frame_t *frame, const sgp4_soa_t *teme,
+                      size_t n, sgp4_lookmat_t *out)
+{
+    sgp4simdtype isa = sgp4_simd_detect();
+    sgp4_soa_t ecef;
+    double *buf;
+    size_t j;
+
+    buf = look_rotate(frame, teme, n, &ecef);
+    if (buf == NULL)
+    {
+        return false;
+    }
+
+    for(j = 0; j < m; j++)
+    {
+        look_row(isa, &obs[j], ecef.x, ecef.y, ecef.z, n, &out->range[j * n], &out->az[j * n], &out->el[j * n]);
+    }
+
+    free(buf);
+
+    return true;
+}
+
+size_t sgp4_look_sparse(const sgp4_observer_t obs[], size_t m, const sgp4_frame_t *frame, const sgp4_soa_t *teme,
+                        size_t n, double minel, sgp4_lookentry_t entries[], size_t max)
+{
+    sgp4simdtype isa = sgp4_simd_detect();
+    double range[LOOK_CHUNK], az[LOOK_CHUNK], el[LOOK_CHUNK];
+    sgp4_soa_t ecef;
+    double *buf;
+    size_t j, k, i, len, count = 0;
+
+    buf = look_rotate(frame, teme, n, &ecef);
+    if (buf == NULL)
+    {
+        return (size_t)-1;
+    }
+
+    for(j = 0; j < m; j++)
+    {
+        for(k = 0; k < n; k += LOOK_CHUNK)
+        {
+            len = (n - k < LOOK_CHUNK) ? n - k : LOOK_CHUNK;
+            look_row(isa, &obs[j], ecef.x + k, ecef.y + k, ecef.z + k, len, range, az, el);
+
+            for(i = 0; i < len; i++)
+            {
+                if (el[i] >= minel)     /* False for NAN */
+                {
+                    if (count < max)
+                    {
+                        entries[count].observer  = (uint32_t)j;
+                        entries[count].satellite = (uint32_t)(k + i);
+                        entries[count].range     = range[i];
+                        entries[count].az        = az[i];
+                        entries[count].el        = el[i];
+                    }
+                    count++;
+                }
+            }
+        }
+    }
+
+    free(buf);
+
+    return count;
+}
+
+/** \} End of sgp4look group */
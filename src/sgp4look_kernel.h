@@ -0,0 +1,91 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Look angle kernel for one instruction set.
+ *
+ * Vector transcription of look_point in sgp4look.c, one satellite per lane.
+ *
+ * This file is a template: it has no include guard and is included once per instruction set
+ * by sgp4look.c, which must define before including it:
+ *
+ * - VD, VL, VFN(name) and VATTR, as described in sgp4vmath.h.
+ * - VW: number of lanes.
+ * - VTARGET: attributes of the non inlined entry point.
+ * - VSQRT(x): lane-wise square root.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4look
+ * \{
+ */
+
+#include "sgp4vmath.h"
+
+/* Converts the leading multiple of VW satellites, returns how many were converted */
+VTARGET size_t VFN(look_run)(const sgp4_observer_t *obs, const double x[], const double y[], const double z[],
+                             size_t n, double range[], double az[], double el[])
+{
+    VD rx, ry, rz, t0, t1, s, e, u, h, vaz, vel, vrange;
+    size_t i;
+
+    for(i = 0; i + VW <= n; i += VW)
+    {
+        memcpy(&rx, x + i, sizeof(rx));
+        memcpy(&ry, y + i, sizeof(ry));
+        memcpy(&rz, z + i, sizeof(rz));
+
+        rx = rx - obs->rs[0];
+        ry = ry - obs->rs[1];
+        rz = rz - obs->rs[2];
+
+        /* SEZ components */
+        t0 = obs->clon * rx + obs->slon * ry;
+        t1 = obs->clon * ry - obs->slon * rx;
+        s  = obs->ccolat * t0 - obs->scolat * rz;
+        e  = t1;
+        u  = obs->ccolat * rz + obs->scolat * t0;
+
+        h      = VSQRT(s * s + e * e);
+        vrange = VSQRT(rx * rx + ry * ry + rz * rz);
+        vel    = VFN(vatan2)(u, h);
+        vaz    = VFN(vatan2)(e, -s);
+        vaz    = VFN(vsel)(h < LOOK_SMALL, VFN(vsplat)(NAN), vaz);
+
+        memcpy(range + i, &vrange, sizeof(vrange));
+        memcpy(az + i, &vaz, sizeof(vaz));
+        memcpy(el + i, &vel, sizeof(vel));
+    }
+
+    return i;
+}
+
+/** \} End of sgp4look group */
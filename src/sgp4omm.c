@@ -0,0 +1,852 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Streaming readers of Orbit Mean-elements Messages (OMM) implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4omm
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <sgp4/sgp4omm.h>
+
+/* Fields of a record */
+typedef enum
+{
+    omm_name,
+    omm_id,
+    omm_epoch,
+    omm_meanmotion,
+    omm_ecc,
+    omm_incl,
+    omm_raan,
+    omm_argp,
+    omm_anomaly,
+    omm_norad,
+    omm_bstar,
+    omm_ndot,
+    omm_nddot,
+    omm_nfields
+} ommfield;
+
+static const char *const omm_keys[omm_nfields] = {"OBJECT_NAME", "OBJECT_ID", "EPOCH", "MEAN_MOTION",
+                                                  "ECCENTRICITY", "INCLINATION", "RA_OF_ASC_NODE",
+                                                  "ARG_OF_PERICENTER", "MEAN_ANOMALY", "NORAD_CAT_ID",
+                                                  "BSTAR", "MEAN_MOTION_DOT", "MEAN_MOTION_DDOT"};
+
+#define OMM_REQUIRED    ((1u << omm_epoch) | (1u << omm_meanmotion) | (1u << omm_ecc) | (1u << omm_incl) | \
+                         (1u << omm_raan) | (1u << omm_argp) | (1u << omm_anomaly) | (1u << omm_norad) | \
+                         (1u << omm_bstar))
+
+/* Powers of ten exact in double */
+static const double omm_pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+                                   1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/* Cumulative days before each month of a common year */
+static const int omm_monthdays[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+/* Fields decoded so far */
+typedef struct
+{
+    unsigned have;              /* Bit of each field decoded */
+    bool bad;                   /* A field could not be decoded */
+    long satnum;
+    int year;
+    double epochdays, no, ecco, inclo, nodeo, argpo, mo, bstar, ndot, nddot;
+} ommrec;
+
+static bool omm_space(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+static void omm_trim(const char **p, size_t *len)
+{
+    while ((*len > 0) && omm_space(**p))
+    {
+        (*p)++;
+        (*len)--;
+    }
+    while ((*len > 0) && omm_space((*p)[*len - 1]))
+    {
+        (*len)--;
+    }
+}
+
+static int omm_lookup(const char *key, size_t len)
+{
+    int i;
+
+    for(i = 0; i < omm_nfields; i++)
+    {
+        if ((strlen(omm_keys[i]) == len) && (memcmp(omm_keys[i], key, len) == 0))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Decimal number. Up to 19 digits and a power of ten up to 22 give the correctly rounded
+   value with one multiplication or division; longer numbers go through strtod */
+static bool omm_number(const char *p, size_t len, double *value)
+{
+    char buf[64];
+    uint64_t m = 0;
+    size_t i = 0;
+    int ndigits = 0, e = 0, ee = 0, esign = 1;
+    bool neg = false, digits = false;
+
+    omm_trim(&p, &len);
+
+    if ((i < len) && ((p[i] == '-') || (p[i] == '+')))
+    {
+        neg = (p[i] == '-');
+        i++;
+    }
+    for(; (i < len) && (p[i] >= '0') && (p[i] <= '9'); i++)
+    {
+        digits = true;
+        if ((m == 0) && (p[i] == '0'))
+        {
+            continue;
+        }
+        m = m * 10 + (uint64_t)(p[i] - '0');
+        ndigits++;
+    }
+    if ((i < len) && (p[i] == '.'))
+    {
+        for(i++; (i < len) && (p[i] >= '0') && (p[i] <= '9'); i++)
+        {
+            digits = true;
+            e--;
+            if ((m == 0) && (p[i] == '0'))
+            {
+                continue;
+            }
+            m = m * 10 + (uint64_t)(p[i] - '0');
+            ndigits++;
+        }
+    }
+    if (!digits)
+    {
+        return false;
+    }
+    if ((i < len) && ((p[i] == 'e') || (p[i] == 'E')))
+    {
+        i++;
+        if ((i < len) && ((p[i] == '-') || (p[i] == '+')))
+        {
+            esign = (p[i] == '-') ? -1 : 1;
+            i++;
+        }
+        if ((i >= len) || (p[i] < '0') || (p[i] > '9'))
+        {
+            return false;
+        }
+        for(; (i < len) && (p[i] >= '0') && (p[i] <= '9') && (ee < 10000); i++)
+        {
+            ee = ee * 10 + (p[i] - '0');
+        }
+        e += esign * ee;
+    }
+    if (i != len)
+    {
+        return false;
+    }
+
+    if ((ndigits > 19) || (m >= (UINT64_C(1) << 53)) || (e < -22) || (e > 22))
+    {
+        if (len >= sizeof(buf))
+        {
+            return false;
+        }
+        memcpy(buf, p, len);
+        buf[len] = '\0';
+        *value = strtod(buf, NULL);
+        return true;
+    }
+
+    *value = (e < 0) ? (double)m / omm_pow10[-e] : (double)m * omm_pow10[e];
+    if (neg)
+    {
+        *value = -*value;
+    }
+
+    return true;
+}
+
+static bool omm_integer(const char *p, size_t len, long *value)
+{
+    size_t i;
+
+    omm_trim(&p, &len);
+    if ((len == 0) || (len > 9))
+    {
+        return false;
+    }
+
+    *value = 0;
+    for(i = 0; i < len; i++)
+    {
+        if ((p[i] < '0') || (p[i] > '9'))
+        {
+            return false;
+        }
+        *value = *value * 10 + (p[i] - '0');
+    }
+    return true;
+}
+
+/* Fixed width unsigned number */
+static bool omm_digits(const char *p, int width, int *value)
+{
+    int i;
+
+    *value = 0;
+    for(i = 0; i < width; i++)
+    {
+        if ((p[i] < '0') || (p[i] > '9'))
+        {
+            return false;
+        }
+        *value = *value * 10 + (p[i] - '0');
+    }
+    return true;
+}
+
+/* Epoch as YYYY-MM-DDThh:mm:ss[.f] or YYYY-DDDThh:mm:ss[.f], optionally ending in Z */
+static bool omm_date(const char *p, size_t len, int *year, double *days)
+{
+    int mon, day, hr, minute, n;
+    double sec;
+
+    omm_trim(&p, &len);
+    if ((len > 0) && (p[len - 1] == 'Z'))
+    {
+        len--;
+    }
+    if ((len < 17) || !omm_digits(p, 4, year) || (p[4] != '-'))
+    {
+        return false;
+    }
+
+    if (p[7] == '-')
+    {
+        if (!omm_digits(&p[5], 2, &mon) || !omm_digits(&p[8], 2, &day) || (mon < 1) || (mon > 12))
+        {
+            return false;
+        }
+        day += omm_monthdays[mon - 1];
+        if ((mon > 2) && (*year % 4 == 0) && ((*year % 100 != 0) || (*year % 400 == 0)))
+        {
+            day++;
+        }
+        n = 10;
+    }
+    else
+    {
+        if (!omm_digits(&p[5], 3, &day))
+        {
+            return false;
+        }
+        n = 8;
+    }
+
+    if ((len < (size_t)n + 9) || (p[n] != 'T') || !omm_digits(&p[n + 1], 2, &hr) || (p[n + 3] != ':') ||
+        !omm_digits(&p[n + 4], 2, &minute) || (p[n + 6] != ':') || !omm_number(&p[n + 7], len - n - 7, &sec))
+    {
+        return false;
+    }
+
+    *days = day + (hr * 3600.0 + minute * 60.0 + sec) / 86400.0;
+
+    return true;
+}
+
+/* Decodes the value of one field */
+static void omm_value(ommrec *rec, sgp4_ommentry_t *entry, int field, const char *p, size_t len)
+{
+    bool ok = true;
+
+    switch(field)
+    {
+        case omm_name:          omm_trim(&p, &len); entry->name = p; entry->namelen = len; break;
+        case omm_id:            omm_trim(&p, &len); entry->id = p; entry->idlen = len; break;
+        case omm_epoch:         ok = omm_date(p, len, &rec->year, &rec->epochdays); break;
+        case omm_meanmotion:    ok = omm_number(p, len, &rec->no); break;
+        case omm_ecc:           ok = omm_number(p, len, &rec->ecco); break;
+        case omm_incl:          ok = omm_number(p, len, &rec->inclo); break;
+        case omm_raan:          ok = omm_number(p, len, &rec->nodeo); break;
+        case omm_argp:          ok = omm_number(p, len, &rec->argpo); break;
+        case omm_anomaly:       ok = omm_number(p, len, &rec->mo); break;
+        case omm_norad:         ok = omm_integer(p, len, &rec->satnum); break;
+        case omm_bstar:         ok = omm_number(p, len, &rec->bstar); break;
+        case omm_ndot:          ok = omm_number(p, len, &rec->ndot); break;
+        case omm_nddot:         ok = omm_number(p, len, &rec->nddot); break;
+        default:                return;
+    }
+
+    if (ok)
+    {
+        rec->have |= 1u << field;
+    }
+    else
+    {
+        rec->bad = true;
+    }
+}
+
+/* Converts the fields to sgp4 units like twoline_parse and runs sgp4init */
+static tlestatus omm_finish(const ommrec *rec, char opsmode, gravconsttype whichconst, elsetrec *satrec)
+{
+    const double deg2rad = pi / 180.0;
+    const double xpdotp  = 1440.0 / (2.0 * pi);
+
+    double tumin, mu, radiusearthkm, xke, j2, j3, j4, j3oj2;
+
+    if (rec->bad || ((rec->have & OMM_REQUIRED) != OMM_REQUIRED) || (rec->ecco < 0.0) || (rec->ecco >= 1.0) ||
+        (rec->no <= 0.0))
+    {
+        return tle_eformat;
+    }
+    if (satrec == NULL)
+    {
+        return tle_ok;
+    }
+
+    getgravconst(whichconst, &tumin, &mu, &radiusearthkm, &xke, &j2, &j3, &j4, &j3oj2);
+
+    satrec->error      = 0;
+    satrec->satnum     = rec->satnum;
+    satrec->epochyr    = rec->year % 100;
+    satrec->epochdays  = rec->epochdays;
+    satrec->jdsatepoch = 367.0 * rec->year - floor(7 * rec->year * 0.25) + 30.0 + 1721013.5 + rec->epochdays;
+
+    satrec->no    = rec->no / xpdotp;       /* rad/min */
+    satrec->ndot  = rec->ndot / (xpdotp * 1440.0);
+    satrec->nddot = rec->nddot / (xpdotp * 1440.0 * 1440);
+    satrec->a     = pow(satrec->no * tumin, (-2.0 / 3.0));
+    satrec->alta  = satrec->a * (1.0 + rec->ecco) - 1.0;
+    satrec->altp  = satrec->a * (1.0 - rec->ecco) - 1.0;
+
+    /* sgp4init reports failures in satrec->error only */
+    sgp4init(whichconst, opsmode, (int)rec->satnum, satrec->jdsatepoch - 2433281.5, rec->bstar,
+             rec->ecco, rec->argpo * deg2rad, rec->inclo * deg2rad, rec->mo * deg2rad, satrec->no,
+             rec->nodeo * deg2rad, satrec);
+    if (satrec->error != 0)
+    {
+        return tle_einit;
+    }
+
+    return tle_ok;
+}
+
+/* Field of a CSV line starting at *pos; moves *pos past the following comma */
+static bool csv_field(const char *line, size_t len, size_t *pos, const char **p, size_t *plen)
+{
+    size_t i = *pos;
+
+    while ((i < len) && ((line[i] == ' ') || (line[i] == '\t')))
+    {
+        i++;
+    }
+
+    if ((i < len) && (line[i] == '"'))
+    {
+        /* Quoted field, "" stands for a quote and is left as written */
+        *p = &line[++i];
+        while (i < len)
+        {
+            if (line[i] == '"')
+            {
+                if ((i + 1 < len) && (line[i + 1] == '"'))
+                {
+                    i += 2;
+                    continue;
+                }
+                break;
+            }
+            i++;
+        }
+        if (i >= len)
+        {
+            return false;
+        }
+        *plen = (size_t)(&line[i] - *p);
+        for(i++; (i < len) && (line[i] != ','); i++)
+        {
+        }
+    }
+    else
+    {
+        *p = &line[i];
+        for(; (i < len) && (line[i] != ','); i++)
+        {
+        }
+        *plen = (size_t)(&line[i] - *p);
+    }
+
+    *pos = i + 1;
+
+    return true;
+}
+
+/* Reads the column names of the CSV header */
+static bool csv_header(sgp4_omm_t *omm, const char *line, size_t len)
+{
+    const char *p;
+    size_t pos = 0, plen;
+    unsigned have = 0;
+    int field;
+
+    omm->ncolumns = 0;
+    while (pos <= len)
+    {
+        if ((omm->ncolumns == SGP4_OMM_COLUMNS) || !csv_field(line, len, &pos, &p, &plen))
+        {
+            return false;
+        }
+        omm_trim(&p, &plen);
+        field = omm_lookup(p, plen);
+        omm->columns[omm->ncolumns++] = (signed char)field;
+        if (field >= 0)
+        {
+            have |= 1u << field;
+        }
+    }
+
+    return (have & OMM_REQUIRED) == OMM_REQUIRED;
+}
+
+static bool csv_next(sgp4_omm_t *omm, ommrec *rec, sgp4_ommentry_t *entry)
+{
+    const char *line, *p;
+    size_t len, pos = 0, plen;
+    int column = 0;
+
+    do
+    {
+        if ((omm->ncolumns < 0) || !sgp4_reader_line(&omm->text, &line, &len))
+        {
+            return false;
+        }
+        entry->lineno = omm->text.lineno - 1;
+        omm_trim(&line, &len);
+    } while (len == 0);
+
+    if (omm->ncolumns == 0)
+    {
+        if (!csv_header(omm, line, len))
+        {
+            /* Without the columns nothing else can be read */
+            omm->ncolumns = -1;
+            rec->bad = true;
+            return true;
+        }
+        return csv_next(omm, rec, entry);
+    }
+
+    while (pos <= len)
+    {
+        if ((column == omm->ncolumns) || !csv_field(line, len, &pos, &p, &plen))
+        {
+            rec->bad = true;
+            return true;
+        }
+        omm_value(rec, entry, omm->columns[column++], p, plen);
+    }
+    if (column != omm->ncolumns)
+    {
+        rec->bad = true;
+    }
+
+    return true;
+}
+
+static bool kvn_next(sgp4_omm_t *omm, ommrec *rec, sgp4_ommentry_t *entry)
+{
+    const char *line, *key, *value, *eq;
+    size_t len, keylen, valuelen, pos, lineno;
+    bool started = false;
+    int field;
+
+    for(;;)
+    {
+        pos = omm->text.pos;
+        lineno = omm->text.lineno;
+        if (!sgp4_reader_line(&omm->text, &line, &len))
+        {
+            return started;
+        }
+        omm_trim(&line, &len);
+        if ((len == 0) || ((len >= 7) && (memcmp(line, "COMMENT", 7) == 0)))
+        {
+            continue;
+        }
+
+        eq = (const char *)memchr(line, '=', len);
+        if (eq == NULL)
+        {
+            /* Not a keyword line */
+            if (!started)
+            {
+                entry->lineno = lineno;
+                started = true;
+            }
+            rec->bad = true;
+            continue;
+        }
+        key = line;
+        keylen = (size_t)(eq - line);
+        omm_trim(&key, &keylen);
+        value = eq + 1;
+        valuelen = (size_t)(line + len - value);
+        field = omm_lookup(key, keylen);
+
+        /* A new message, or a field already seen, starts the next record */
+        if (started && (((keylen == 14) && (memcmp(key, "CCSDS_OMM_VERS", 14) == 0)) ||
+                        ((field >= 0) && (rec->have & (1u << field)))))
+        {
+            omm->text.pos = pos;
+            omm->text.lineno = lineno;
+            return true;
+        }
+        if (!started)
+        {
+            entry->lineno = lineno;
+            started = true;
+        }
+
+        if (field >= 0)
+        {
+            /* Units in brackets after the value */
+            omm_trim(&value, &valuelen);
+            if ((valuelen > 0) && (value[valuelen - 1] == ']'))
+            {
+                for(; (valuelen > 0) && (value[valuelen - 1] != '['); valuelen--)
+                {
+                }
+                if (valuelen > 0)
+                {
+                    valuelen--;
+                }
+            }
+            omm_value(rec, entry, field, value, valuelen);
+        }
+    }
+}
+
+/* Skips blanks, counting lines */
+static void json_space(sgp4_reader_t *t)
+{
+    for(; (t->pos < t->size) && omm_space(t->data[t->pos]); t->pos++)
+    {
+        if (t->data[t->pos] == '\n')
+        {
+            t->lineno++;
+        }
+    }
+}
+
+/* String at t->pos, without the quotes and with escapes left as written */
+static bool json_string(sgp4_reader_t *t, const char **p, size_t *len)
+{
+    size_t i;
+
+    if ((t->pos >= t->size) || (t->data[t->pos] != '"'))
+    {
+        return false;
+    }
+    for(i = t->pos + 1; (i < t->size) && (t->data[i] != '"'); i++)
+    {
+        if (t->data[i] == '\\')
+        {
+            i++;
+        }
+        else if (t->data[i] == '\n')
+        {
+            return false;
+        }
+    }
+    if (i >= t->size)
+    {
+        return false;
+    }
+
+    *p = &t->data[t->pos + 1];
+    *len = i - t->pos - 1;
+    t->pos = i + 1;
+
+    return true;
+}
+
+/* Skips a value of any kind, counting lines */
+static bool json_skip(sgp4_reader_t *t)
+{
+    const char *p;
+    size_t len;
+    int depth = 0;
+
+    do
+    {
+        json_space(t);
+        if (t->pos >= t->size)
+        {
+            return false;
+        }
+        switch(t->data[t->pos])
+        {
+            case '"':
+                if (!json_string(t, &p, &len))
+                {
+                    return false;
+                }
+                break;
+            case '{':
+            case '[':
+                depth++;
+                t->pos++;
+                break;
+            case '}':
+            case ']':
+                if (depth == 0)
+                {
+                    return false;
+                }
+                depth--;
+                t->pos++;
+                break;
+            case ',':
+            case ':':
+                if (depth == 0)
+                {
+                    return false;
+                }
+                t->pos++;
+                break;
+            default:
+                for(; (t->pos < t->size) && !omm_space(t->data[t->pos]) && (t->data[t->pos] != ',') &&
+                      (t->data[t->pos] != '}') && (t->data[t->pos] != ']'); t->pos++)
+                {
+                }
+                break;
+        }
+    } while (depth > 0);
+
+    return true;
+}
+
+/* Members of an object, after its '{' */
+static bool json_object(sgp4_reader_t *t, ommrec *rec, sgp4_ommentry_t *entry)
+{
+    const char *key, *value;
+    size_t keylen, valuelen, start;
+    int field;
+
+    for(;;)
+    {
+        json_space(t);
+        if (t->pos >= t->size)
+        {
+            return false;
+        }
+        if (t->data[t->pos] == '}')
+        {
+            t->pos++;
+            return true;
+        }
+        if (t->data[t->pos] == ',')
+        {
+            t->pos++;
+            continue;
+        }
+
+        if (!json_string(t, &key, &keylen))
+        {
+            return false;
+        }
+        json_space(t);
+        if ((t->pos >= t->size) || (t->data[t->pos] != ':'))
+        {
+            return false;
+        }
+        t->pos++;
+        json_space(t);
+
+        field = omm_lookup(key, keylen);
+        if ((t->pos < t->size) && (t->data[t->pos] == '"'))
+        {
+            if (!json_string(t, &value, &valuelen))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            start = t->pos;
+            if (!json_skip(t))
+            {
+                return false;
+            }
+            value = &t->data[start];
+            valuelen = t->pos - start;
+        }
+        if (field >= 0)
+        {
+            omm_value(rec, entry, field, value, valuelen);
+        }
+    }
+}
+
+static bool json_next(sgp4_omm_t *omm, ommrec *rec, sgp4_ommentry_t *entry)
+{
+    sgp4_reader_t *t = &omm->text;
+    const char *p;
+    size_t len;
+
+    for(;;)
+    {
+        json_space(t);
+        if (t->pos >= t->size)
+        {
+            return false;
+        }
+        if ((t->data[t->pos] == '[') || (t->data[t->pos] == ']') || (t->data[t->pos] == ','))
+        {
+            t->pos++;
+            continue;
+        }
+        break;
+    }
+
+    entry->lineno = t->lineno;
+    if (t->data[t->pos] == '{')
+    {
+        t->pos++;
+        if (json_object(t, rec, entry))
+        {
+            return true;
+        }
+    }
+
+    /* Syntax error: the record ends at the next '}' outside strings */
+    rec->bad = true;
+    while ((t->pos < t->size) && (t->data[t->pos] != '}'))
+    {
+        if ((t->data[t->pos] != '"') || !json_string(t, &p, &len))
+        {
+            if (t->data[t->pos] == '\n')
+            {
+                t->lineno++;
+            }
+            t->pos++;
+        }
+    }
+    if (t->pos < t->size)
+    {
+        t->pos++;
+    }
+
+    return true;
+}
+
+bool sgp4_omm_open(const char *path, ommformat format, sgp4_omm_t *omm)
+{
+    memset(omm, 0, sizeof(*omm));
+    omm->format = format;
+
+    return sgp4_reader_open(path, &omm->text);
+}
+
+void sgp4_omm_init(const char *data, size_t size, ommformat format, sgp4_omm_t *omm)
+{
+    memset(omm, 0, sizeof(*omm));
+    omm->format = format;
+    sgp4_reader_init(data, size, &omm->text);
+}
+
+void sgp4_omm_close(sgp4_omm_t *omm)
+{
+    sgp4_reader_close(&omm->text);
+}
+
+bool sgp4_omm_next(sgp4_omm_t *omm, char opsmode, gravconsttype whichconst, sgp4_ommentry_t *entry,
+                   elsetrec *satrec)
+{
+    ommrec rec;
+    bool found;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(entry, 0, sizeof(*entry));
+
+    switch(omm->format)
+    {
+        case omm_csv:   found = csv_next(omm, &rec, entry); break;
+        case omm_json:  found = json_next(omm, &rec, entry); break;
+        case omm_kvn:   found = kvn_next(omm, &rec, entry); break;
+        default:        found = false; break;
+    }
+    if (!found)
+    {
+        return false;
+    }
+
+    entry->status = omm_finish(&rec, opsmode, whichconst, satrec);
+
+    return true;
+}
+
+size_t sgp4_omm_read(sgp4_omm_t *omm, char opsmode, gravconsttype whichconst, sgp4_ommentry_t entries[],
+                     elsetrec satrecs[], size_t max)
+{
+    sgp4_ommentry_t entry;
+    size_t n;
+
+    for(n = 0; n < max; n++)
+    {
+        if (!sgp4_omm_next(omm, opsmode, whichconst, (entries != NULL) ? &entries[n] : &entry,
+                           (satrecs != NULL) ? &satrecs[n] : NULL))
+        {
+            break;
+        }
+    }
+
+    return n;
+}
+
+/** \} End of sgp4omm group */
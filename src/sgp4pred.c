@@ -6,11 +6,13 @@ Written by Hopperpop
 */
 
 #include <stdint.h>
+#include <string.h>
 
 #include <sgp4/sgp4ext.h>
 #include <sgp4/sgp4unit.h>
 #include <sgp4/sgp4io.h>
 #include <sgp4/sgp4coord.h>
+#include <sgp4/sgp4geod.h>
 #include <sgp4/brent.h>
 #include <sgp4/sgp4pred.h>
 #include <sgp4/visible.h>
@@ -18,6 +20,15 @@ Written by Hopperpop
 #define MAX_itter   30
 #define tol         0.000005    /* tol = +-0,432 sec */
 
+#define TRACK_MINSTEP   (1.0 / 86400.0)     /* Shortest anchor spacing of the tracking mode (1 sec) */
+
+#define SGP4_PENDING_LLH    0x01    /* satLat, satLon and satAlt not computed yet */
+#define SGP4_PENDING_SUN    0x02    /* satVis, sunAz and sunEl not computed yet */
+#define SGP4_PENDING_RSUN   0x04    /* Sun vector of the frame not computed yet */
+#define SGP4_PENDING_RATES  0x08    /* satRangeRate, satAzRate and satElRate not computed yet */
+
+#define SGP4_LIGHTSPEED     299792.458  /* Speed of light (km/s) */
+
 /* Init functions */
 bool sgp4_init(sgp4_t *conf, const char naam[24], char longstr1[130], char longstr2[130])
 {
@@ -25,6 +36,9 @@ bool sgp4_init(sgp4_t *conf, const char naam[24], char longstr1[130], char longs
     conf->whichconst = wgs84;                /* Newest constants */
     conf->sunoffset  = -0.10471975511966;    /* Sun aboven -6o => not dark enough */
     conf->offset     = 0.0;
+    conf->sinoffset  = 0.0;
+    conf->tracking   = false;                /* Tracking mode needs the new elements (see sgp4_track) */
+    conf->pending    = 0;
 
     if (strcmp(longstr1, line1) == 0)
     {
@@ -50,6 +64,7 @@ void sgp4_site(sgp4_t *conf, double lat, double lon, double alt)
     conf->siteAlt = alt / 1000;  /* meters to kilometers */
     conf->siteLatRad = siteLat * pi / 180.0;
     conf->siteLonRad = siteLon * pi / 180.0;
+    observerinit(conf->siteLatRad, conf->siteLonRad, conf->siteAlt, &conf->observer);
 }
 
 /* Set sunoffset */
@@ -58,35 +73,331 @@ void sgp4_setsunrise(sgp4_t *conf, double degrees)
     conf->sunoffset = degrees * pi / 180.0;
 }
 
+/* Tracking mode */
+
+/* Full sgp4 propagation to a julian date, returns false when sgp4 reports an error */
+static bool sgp4_trackpoint(sgp4_t *conf, double jd, double r[3], double v[3])
+{
+    sgp4(conf->whichconst, &conf->satrec, (jd - conf->satrec.jdsatepoch) * 1440.0, r, v);
+
+    return conf->satrec.error == 0;
+}
+
+/* Cubic Hermite interpolation between the two anchors, s = 0 at jdA and s = 1 at jdB */
+static void sgp4_hermite(const sgp4_t *conf, double s, double r[3], double v[3])
+{
+    double h   = (conf->jdB - conf->jdA) * 86400.0;     /* Anchor spacing (sec), velocities are in km/s */
+    double s2  = s * s;
+    double s3  = s2 * s;
+    double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    double h10 = (s3 - 2.0 * s2 + s) * h;
+    double h01 = 3.0 * s2 - 2.0 * s3;
+    double h11 = (s3 - s2) * h;
+    double d00 = (6.0 * s2 - 6.0 * s) / h;
+    double d10 = 3.0 * s2 - 4.0 * s + 1.0;
+    double d11 = 3.0 * s2 - 2.0 * s;
+    int i;
+
+    for(i = 0; i < 3; i++)
+    {
+        r[i] = h00 * conf->rA[i] + h10 * conf->vA[i] + h01 * conf->rB[i] + h11 * conf->vB[i];
+        v[i] = d00 * (conf->rA[i] - conf->rB[i]) + d10 * conf->vA[i] + d11 * conf->vB[i];
+    }
+}
+
+/*
+ * Places the second anchor at most h days after the first one. The interpolation is checked
+ * against sgp4 at a quarter of the interval, near the maximum of the error that comes from
+ * sgp4 velocities not being the exact derivative of its positions. While the check is off by
+ * more than half the tolerance, the check point becomes the new second anchor. Returns false
+ * when the tolerance is not met at the shortest spacing (a discontinuity of sgp4 itself), or
+ * when sgp4 fails at the second anchor or a check point, so the interval is not interpolated.
+ */
+static bool sgp4_trackspan(sgp4_t *conf, double h)
+{
+    double r[3], v[3], ri[3], vi[3];
+    double d;
+
+    conf->jdB = conf->jdA + h;
+    conf->trackokB = sgp4_trackpoint(conf, conf->jdB, conf->rB, conf->vB);
+    if (!conf->trackokB)
+    {
+        return false;
+    }
+
+    while (true)
+    {
+        if (!sgp4_trackpoint(conf, conf->jdA + h / 4.0, r, v))
+        {
+            return false;
+        }
+        sgp4_hermite(conf, 0.25, ri, vi);
+
+        d = sqrt((r[0] - ri[0]) * (r[0] - ri[0]) + (r[1] - ri[1]) * (r[1] - ri[1]) + (r[2] - ri[2]) * (r[2] - ri[2]));
+        if (d <= 0.5 * conf->tracktol)
+        {
+            return true;
+        }
+
+        if (h < 4.0 * TRACK_MINSTEP)
+        {
+            return false;
+        }
+
+        h /= 4.0;
+        conf->jdB = conf->jdA + h;
+        memcpy(conf->rB, r, sizeof(conf->rB));
+        memcpy(conf->vB, v, sizeof(conf->vB));
+    }
+}
+
+/* Sets ro and vo for a julian date, from the anchors when tracking */
+static void sgp4_trackpos(sgp4_t *conf, double jd)
+{
+    double h;
+
+    if (!conf->tracking)
+    {
+        sgp4_trackpoint(conf, jd, conf->ro, conf->vo);
+        return;
+    }
+
+    if ((jd < conf->jdA) || (jd > conf->jdB + conf->trackstep))  /* Jump in time, restart from jd */
+    {
+        conf->jdA = jd;
+        conf->jdB = jd + conf->trackstep;   /* Set first, so the anchors move forward even when sgp4 fails at jd */
+        conf->trackokB = false;
+        conf->trackok = sgp4_trackpoint(conf, jd, conf->rA, conf->vA) && sgp4_trackspan(conf, conf->trackstep);
+    }
+
+    while (jd > conf->jdB)  /* Moving forward, the second anchor becomes the first one */
+    {
+        h = fmin(4.0 * (conf->jdB - conf->jdA), conf->trackstep);  /* Grows back after a shortened interval */
+        conf->jdA = conf->jdB;
+        conf->jdB = conf->jdA + h;
+        if (conf->trackokB)
+        {
+            memcpy(conf->rA, conf->rB, sizeof(conf->rA));
+            memcpy(conf->vA, conf->vB, sizeof(conf->vA));
+        }
+        /* Where sgp4 failed at the second anchor, or it was not propagated, it is tried again */
+        conf->trackok = (conf->trackokB || sgp4_trackpoint(conf, conf->jdA, conf->rA, conf->vA)) && sgp4_trackspan(conf, h);
+    }
+
+    if (!conf->trackok)     /* Full sgp4 at jd across discontinuities, and where an anchor failed */
+    {
+        sgp4_trackpoint(conf, jd, conf->ro, conf->vo);
+        return;
+    }
+
+    sgp4_hermite(conf, (jd - conf->jdA) / (conf->jdB - conf->jdA), conf->ro, conf->vo);
+    conf->satrec.error = 0;     /* Both anchors and the check point of the interval propagated without error */
+}
+
+void sgp4_track(sgp4_t *conf, double tolerance)
+{
+    double tumin, mu, radiusearthkm, xke, j2, j3, j4, j3oj2;
+    double a, rp, w, step, period;
+
+    conf->tracking = (tolerance > 0.0);
+    if (!conf->tracking)
+    {
+        return;
+    }
+
+    getgravconst(conf->whichconst, &tumin, &mu, &radiusearthkm, &xke, &j2, &j3, &j4, &j3oj2);
+
+    /*
+     * The truncation error of the cubic Hermite interpolation is at most h^4/384 max|d4r/dt4|.
+     * On a keplerian orbit |d4r/dt4| peaks near w^4 rp, w being the angular rate at perigee.
+     * The nominal step aims at half the tolerance, which passes the check in sgp4_trackspan.
+     */
+    a       = pow(xke / conf->satrec.no, 2.0 / 3.0) * radiusearthkm;
+    rp      = a * (1.0 - conf->satrec.ecco);
+    w       = sqrt(mu * (1.0 + conf->satrec.ecco) / (rp * rp * rp));
+    step    = pow(192.0 * tolerance / (w * w * w * w * rp), 0.25) / 86400.0;
+    period  = 2.0 * pi * sqrt(a * a * a / mu) / 86400.0;
+
+    conf->tracktol  = tolerance;
+    conf->trackstep = fmax(fmin(step, period / 8.0), TRACK_MINSTEP);
+    conf->jdA       = 0.0;
+    conf->jdB       = 0.0;
+}
+
 /* Location functions */
-void sgp4_findsat(sgp4_t *conf, double jdI)
+
+/* Position, range, azimuth and elevation at the julian date of conf->frame */
+static void sgp4_findazel(sgp4_t *conf)
+{
+    double jd = conf->frame.jdut1;
+
+    conf->jdC = jd;
+
+    sgp4_trackpos(conf, jd);
+    memcpy(conf->satro, conf->ro, sizeof(conf->satro));
+    memcpy(conf->satvo, conf->vo, sizeof(conf->satvo));
+    teme2ecef_frame(conf->ro, &conf->frame, conf->recef);
+    ecef2azel_observer(conf->recef, &conf->observer, conf->razel);
+
+    conf->satAz     = floatmod(conf->razel[1] * 180 / pi + 360.0, 360.0);       /* Azemith sattelite (degrees) */
+    conf->satEl     = conf->razel[2] * 180 / pi;                                /* elevation sattelite (degrees) */
+    conf->satDist   = conf->razel[0];                                           /* Distance to sattelite (km) */
+    conf->satJd     = jd;                                                       /* time (julian day) */
+    conf->pending   = SGP4_PENDING_LLH | SGP4_PENDING_SUN | SGP4_PENDING_RATES;
+}
+
+/* Latitude, longitude and altitude, from the ECEF vector of the last sgp4_findazel */
+static void sgp4_findll(sgp4_t *conf)
 {
     double latlongh[3];
-    double recef[3];
-    double vecef[3];
-    double razelrates[3];
 
-    conf->jdC = jdI;
+    if (!(conf->pending & SGP4_PENDING_LLH))
+    {
+        return;
+    }
+
+    ecef2geod(conf->recef, latlongh);
+
+    conf->satLat    = latlongh[0] * 180 / pi;   /* Latidude sattelite (degrees) */
+    conf->satLon    = latlongh[1] * 180 / pi;   /* longitude sattelite (degrees) */
+    conf->satAlt    = latlongh[2];              /* Altitude sattelite (degrees) */
+    conf->pending  &= ~SGP4_PENDING_LLH;
+}
+
+/* Range rate, azimuth rate and elevation rate, from the state saved by the last sgp4_findazel */
+static void sgp4_findrates(sgp4_t *conf)
+{
+    double recef[3], vecef[3];
+    double razel[3], razelrates[3];
+
+    if (!(conf->pending & SGP4_PENDING_RATES))
+    {
+        return;
+    }
+
+    teme2ecefv_frame(conf->satro, conf->satvo, &conf->frame, recef, vecef);
+    ecef2azelrates_observer(recef, vecef, &conf->observer, razel, razelrates);
 
-    double tsince = (jdC - satrec.jdsatepoch) * 24.0 * 60.0;
-    sgp4(whichconst, satrec, tsince, ro, vo);
-    rv2azel(ro, siteLatRad, siteLonRad, siteAlt, jdC, razel);
-    teme2ecef(ro, jdC, recef);
-    ijk2ll(recef, latlongh);
+    conf->satRangeRate  = razelrates[0];                /* Range rate (km/s) */
+    conf->satAzRate     = razelrates[1] * 180 / pi;     /* Azimuth rate (degrees/s) */
+    conf->satElRate     = razelrates[2] * 180 / pi;     /* Elevation rate (degrees/s) */
+    conf->pending      &= ~SGP4_PENDING_RATES;
+}
+
+/* Sun position and visibility at the julian date of the last sgp4_findazel */
+static void sgp4_findvis(sgp4_t *conf)
+{
+    bool notdark;
+    double deltaphi;
+
+    if (!(conf->pending & SGP4_PENDING_SUN))
+    {
+        return;
+    }
 
-    conf->satLat    = latlongh[0] * 180 / pi;                       /* Latidude sattelite (degrees) */
-    conf->satLon    = latlongh[1] * 180 / pi;                       /* longitude sattelite (degrees) */
-    conf->satAlt    = latlongh[2];                                  /* Altitude sattelite (degrees) */
-    conf->satAz     = floatmod(razel[1] * 180 / pi + 360.0, 360.0); /* Azemith sattelite (degrees) */
-    conf->satEl     = razel[2] * 180 / pi;                          /* elevation sattelite (degrees) */
-    conf->satDist   = razel[0];                                     /* Distance to sattelite (km) */
-    conf->satJd     = jdI;                                          /* time (julian day) */
+    if (conf->pending & SGP4_PENDING_RSUN)
+    {
+        sun(conf->frame.jdut1, conf->frame.rsun);
+    }
 
-    satVis = visible();
-    if (satEl < 0.0)
+    conf->satVis = sgp4_visible_frame(conf, &conf->frame, conf->satro, &notdark, &deltaphi);
+    if (notdark)
+    {
+        conf->satVis = -1;  /* sun above sunoffset */
+    }
+    if (conf->satEl < 0.0)
     {
-        satVis = -2;    /* under horizon */
+        conf->satVis = -2;  /* under horizon */
     }
+    conf->pending &= ~(SGP4_PENDING_SUN | SGP4_PENDING_RSUN);
+}
+
+void sgp4_findsat(sgp4_t *conf, double jdI)
+{
+    frameinit(jdI, &conf->frame);
+    sgp4_findazel(conf);
+    sgp4_findll(conf);
+    sgp4_findrates(conf);
+    sgp4_findvis(conf);
+}
+
+void sgp4_findsat_frame(sgp4_t *conf, const sgp4_frame_t *frame)
+{
+    conf->frame = *frame;
+    sgp4_findazel(conf);
+    sgp4_findll(conf);
+    sgp4_findrates(conf);
+    sgp4_findvis(conf);
+}
+
+void sgp4_findsat_lazy(sgp4_t *conf, double jdI)
+{
+    framerotation(jdI, &conf->frame);
+    sgp4_findazel(conf);
+    conf->pending |= SGP4_PENDING_RSUN;
+}
+
+double sgp4_getlat(sgp4_t *conf)
+{
+    sgp4_findll(conf);
+
+    return conf->satLat;
+}
+
+double sgp4_getlon(sgp4_t *conf)
+{
+    sgp4_findll(conf);
+
+    return conf->satLon;
+}
+
+double sgp4_getalt(sgp4_t *conf)
+{
+    sgp4_findll(conf);
+
+    return conf->satAlt;
+}
+
+double sgp4_getrangerate(sgp4_t *conf)
+{
+    sgp4_findrates(conf);
+
+    return conf->satRangeRate;
+}
+
+double sgp4_getazrate(sgp4_t *conf)
+{
+    sgp4_findrates(conf);
+
+    return conf->satAzRate;
+}
+
+double sgp4_getelrate(sgp4_t *conf)
+{
+    sgp4_findrates(conf);
+
+    return conf->satElRate;
+}
+
+int16_t sgp4_getvis(sgp4_t *conf)
+{
+    sgp4_findvis(conf);
+
+    return conf->satVis;
+}
+
+double sgp4_getsunaz(sgp4_t *conf)
+{
+    sgp4_findvis(conf);
+
+    return conf->sunAz;
+}
+
+double sgp4_getsunel(sgp4_t *conf)
+{
+    sgp4_findvis(conf);
+
+    return conf->sunEl;
 }
 
 void sgp4_findsat(sgp4_t *conf, unsigned long unix)
@@ -96,15 +407,27 @@ void sgp4_findsat(sgp4_t *conf, unsigned long unix)
 
 //////Predict functions/////////
 
-/* Returns the elevation for a given julian date */
-double sgp4_sgp4wrap(sgp4_t *conf, double jdCe)
+/* Returns the elevation for a given julian date, as sin(offset) - sin(elevation) */
+double sgp4_sgp4wrap(void *obj, double jdCe)
 {
-    double tsince = (jdCe - satrec.jdsatepoch) * 24.0 * 60.0;
+    sgp4_t *conf = (sgp4_t *)obj;
+    double tsince = (jdCe - conf->satrec.jdsatepoch) * 24.0 * 60.0;
+    double recef[3];
+
+    sgp4(conf->whichconst, &conf->satrec, tsince, conf->ro, conf->vo);
+    teme2ecef(conf->ro, jdCe, recef);
+
+    return conf->sinoffset - sinel_observer(recef, &conf->observer);
+}
 
-    sgp4(whichconst, satrec, tsince, ro, vo);
-    rv2azel(ro, siteLatRad, siteLonRad, siteAlt, jdCe, razel);
+/* Position, range, azimuth and elevation at a point found by the overpass search */
+static void sgp4_predpoint(sgp4_t *conf, double jd)
+{
+    double recef[3];
 
-    return -razel[2]+offset;
+    sgp4(conf->whichconst, &conf->satrec, (jd - conf->satrec.jdsatepoch) * 24.0 * 60.0, conf->ro, conf->vo);
+    teme2ecef(conf->ro, jd, recef);
+    ecef2azel_observer(recef, &conf->observer, conf->razel);
 }
 
 
@@ -147,7 +470,7 @@ bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc
     for(i = 0; i < itterations && max_elevation <= (minimumElevation * pi / 180); i++)  /* Search for elevation above minimumElevation */
     {
        jdCp+= jump;
-       max_elevation = - brentmin(jdCp - range , jdCp, jdCp + range, &Sgp4::sgp4wrap , tol, &jdCp, this);
+       max_elevation = asin(fmin(conf->sinoffset - brentmin(jdCp - range , jdCp, jdCp + range, sgp4_sgp4wrap, tol, &jdCp, conf), 1.0)) - conf->offset;
 		#ifdef ESP8266
 			yield();
 		#endif
@@ -160,6 +483,7 @@ bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc
 
 	/* Max elevation */
 
+    sgp4_predpoint(conf, conf->jdC);
     (*passdata).maxelevation = (max_elevation+offset)*180/pi;
     (*passdata).jdmax = jdC;
 	  (*passdata).azmax = floatmod(razel[1] * 180 / pi + 360.0, 360.0);
@@ -181,11 +505,12 @@ bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc
     /* Start point */
 
     range = 0.5 / revpday;
-    jdC = zbrent(&Sgp4::sgp4wrap, jdCp, jdCp - range, tol, this);
+    jdC = zbrent(sgp4_sgp4wrap, jdCp, jdCp - range, tol, conf);
     if (jdC < 0.0)
     {
         return 0;
     }
+    sgp4_predpoint(conf, conf->jdC);
     (*passdata).jdstart = jdC;
     (*passdata).azstart = floatmod(razel[1] * 180 / pi + 360.0, 360.0);
     vis = visible(isdaylight, startphi);
@@ -206,11 +531,12 @@ bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc
 
     /* Stop point */
 
-    jdC = zbrent(&Sgp4::sgp4wrap, jdCp, jdCp + range, tol, this);
+    jdC = zbrent(sgp4_sgp4wrap, jdCp, jdCp + range, tol, conf);
     if (jdC < 0.0)
     {
         return 0;
     }
+    sgp4_predpoint(conf, conf->jdC);
     (*passdata).jdstop = jdC;
     (*passdata).azstop = floatmod(razel[1] * 180 / pi + 360.0, 360.0);
     vis = visible(isdaylight,stopphi);
@@ -265,11 +591,12 @@ bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc
             (*passdata).transit = leave;
         }
 
-        jdC = zbrent(&Sgp4::visiblewrap, (*passdata).jdstart, (*passdata).jdstop, tol, this);
+        jdC = zbrent(sgp4_visiblewrap, (*passdata).jdstart, (*passdata).jdstop, tol, conf);
         if (jdC < 0.0)
         {
             return 0;
         }
+        sgp4_predpoint(conf, conf->jdC);
         (*passdata).jdtransit = jdC;
         (*passdata).aztransit = floatmod(razel[1] * 180 / pi + 360.0, 360.0);
         (*passdata).transitelevation = razel[2] * 180 / pi;
@@ -291,6 +618,51 @@ bool sgp4_nextpass(sgp4_t *conf, passinfo *passdata, int itterations, bool direc
     return 1;
 }
 
+/* Samples the doppler curve of a pass, one sgp4 call per sample */
+size_t sgp4_dopplercurve(sgp4_t *conf, const passinfo *pass, double step, double frequency, dopplerpoint curve[], size_t max)
+{
+    sgp4_frame_t frame;
+    double razel[3], razelrates[3];
+    double jd, dt = step / 86400.0;
+    size_t i, n;
+
+    if (!(step > 0.0) || !(pass->jdstop >= pass->jdstart))
+    {
+        return 0;
+    }
+
+    n = (size_t)floor((pass->jdstop - pass->jdstart) / dt) + 1;
+
+    for(i = 0; i < n && i < max; i++)
+    {
+        jd = pass->jdstart + i * dt;
+
+        curve[i].jd = jd;
+
+        sgp4(conf->whichconst, &conf->satrec, (jd - conf->satrec.jdsatepoch) * 24.0 * 60.0, conf->ro, conf->vo);
+        if (conf->satrec.error != 0)    /* Decayed or failed, no state to sample */
+        {
+            curve[i].az        = NAN;
+            curve[i].el        = NAN;
+            curve[i].range     = NAN;
+            curve[i].rangerate = NAN;
+            curve[i].doppler   = NAN;
+            continue;
+        }
+
+        framerotation(jd, &frame);
+        rv2azelrates_observer(conf->ro, conf->vo, &conf->observer, &frame, razel, razelrates);
+
+        curve[i].az         = floatmod(razel[1] * 180 / pi + 360.0, 360.0);
+        curve[i].el         = razel[2] * 180 / pi;
+        curve[i].range      = razel[0];
+        curve[i].rangerate  = razelrates[0];
+        curve[i].doppler    = -frequency * razelrates[0] / SGP4_LIGHTSPEED;
+    }
+
+    return n;
+}
+
 /* Finds a startpoint for the prediction algorithm */
 bool sgp4_initpredpoint(sgp4_t *conf, double startpoint, double startelevation)
 {
@@ -299,14 +671,15 @@ bool sgp4_initpredpoint(sgp4_t *conf, double startpoint, double startelevation)
     double jdI;
     int i;
 
-    offset = startelevation * pi /180.0;
+    conf->offset    = startelevation * pi / 180.0;
+    conf->sinoffset = sin(conf->offset);
 
     c = startpoint;
-    fc = sgp4wrap(c);
+    fc = sgp4_sgp4wrap(conf, c);
     b = startpoint - 0.166 / revpday;
-    fb = sgp4wrap(b);
+    fb = sgp4_sgp4wrap(conf, b);
     a = startpoint - 0.322 / revpday;
-    fa = sgp4wrap(a);
+    fa = sgp4_sgp4wrap(conf, a);
 
     for(i = 0; i < MAX_itter && (fb > fa || fb > fc); i++)
     {
@@ -315,14 +688,14 @@ bool sgp4_initpredpoint(sgp4_t *conf, double startpoint, double startelevation)
         c = b;
         b = a;
         a = startpoint - 0.166 * (i + 3) / revpday;
-        fa = sgp4wrap(a);
+        fa = sgp4_sgp4wrap(conf, a);
     }
     if (i >= MAX_itter - 1)
     {
         return 0;
     }
 
-    brentmin(a , b, c, &Sgp4::sgp4wrap , tol, &jdI, this);
+    brentmin(a, b, c, sgp4_sgp4wrap, tol, &jdI, conf);
     jdCp = jdI;
 
     return 1;
@@ -0,0 +1,316 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Streaming reader of two and three line element set catalogs implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4reader
+ * \{
+ */
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <sgp4/sgp4reader.h>
+
+/* Offset of the first '\n' at or after pos, or size when there is none */
+static size_t reader_eol(const char *data, size_t pos, size_t size)
+{
+#if defined(__SSE2__)
+    const __m128i nl = _mm_set1_epi8('\n');
+    int mask;
+
+    for(; pos + 16 <= size; pos += 16)
+    {
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(data + pos)), nl));
+        if (mask != 0)
+        {
+            return pos + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+    for(; pos < size; pos++)
+    {
+        if (data[pos] == '\n')
+        {
+            return pos;
+        }
+    }
+    return size;
+#else
+    const char *eol = memchr(data + pos, '\n', size - pos);
+
+    return (eol == NULL) ? size : (size_t)(eol - data);
+#endif
+}
+
+/* Takes the next line of the catalog, without line end; false at the end of the text */
+static bool reader_line(sgp4_reader_t *rd, const char **line, size_t *len, size_t *lineno)
+{
+    size_t eol;
+
+    if (rd->pos >= rd->size)
+    {
+        return false;
+    }
+
+    eol = reader_eol(rd->data, rd->pos, rd->size);
+    *line = rd->data + rd->pos;
+    *len = eol - rd->pos;
+    *lineno = rd->lineno++;
+    if ((*len > 0) && ((*line)[*len - 1] == '\r'))
+    {
+        (*len)--;
+    }
+    rd->pos = eol + 1;
+
+    return true;
+}
+
+/* Line made only of blanks */
+static bool reader_blank(const char *line, size_t len)
+{
+    size_t i;
+
+    for(i = 0; i < len; i++)
+    {
+        if ((line[i] != ' ') && (line[i] != '\t'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Line of the given number ("1 " or "2 ") */
+static bool reader_isline(const char *line, size_t len, char num)
+{
+    return (len >= 2) && (line[0] == num) && (line[1] == ' ');
+}
+
+bool sgp4_reader_open(const char *path, sgp4_reader_t *rd)
+{
+    struct stat st;
+    void *map;
+    int fd;
+
+    memset(rd, 0, sizeof(*rd));
+    rd->lineno = 1;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    if (st.st_size == 0)
+    {
+        close(fd);
+        return true;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    rd->data = (const char *)map;
+    rd->size = (size_t)st.st_size;
+    rd->map = map;
+    rd->maplen = (size_t)st.st_size;
+
+    return true;
+}
+
+void sgp4_reader_init(const char *data, size_t size, sgp4_reader_t *rd)
+{
+    memset(rd, 0, sizeof(*rd));
+    rd->data = data;
+    rd->size = size;
+    rd->lineno = 1;
+}
+
+void sgp4_reader_close(sgp4_reader_t *rd)
+{
+    if (rd->map != NULL)
+    {
+        munmap(rd->map, rd->maplen);
+    }
+    memset(rd, 0, sizeof(*rd));
+}
+
+bool sgp4_reader_line(sgp4_reader_t *rd, const char **line, size_t *len)
+{
+    size_t lineno;
+
+    return reader_line(rd, line, len, &lineno);
+}
+
+bool sgp4_reader_next(sgp4_reader_t *rd, bool checksum, char opsmode, gravconsttype whichconst,
+                      sgp4_entry_t *entry, elsetrec *satrec)
+{
+    const char *line;
+    size_t len, lineno, pos, next;
+
+    memset(entry, 0, sizeof(*entry));
+
+    for(;;)
+    {
+        pos = rd->pos;
+        next = rd->lineno;
+        if (!reader_line(rd, &line, &len, &lineno))
+        {
+            if (entry->name == NULL)
+            {
+                return false;
+            }
+            /* Name line at the end of the catalog */
+            entry->status = tle_eformat;
+            return true;
+        }
+
+        if (reader_blank(line, len))
+        {
+            continue;
+        }
+
+        if (reader_isline(line, len, '2'))
+        {
+            /* Line 2 without line 1 */
+            if (entry->name == NULL)
+            {
+                entry->lineno = lineno;
+            }
+            entry->line2 = line;
+            entry->len2 = len;
+            entry->status = tle_eformat;
+            return true;
+        }
+
+        if (!reader_isline(line, len, '1'))
+        {
+            if (entry->name != NULL)
+            {
+                /* Name line without elements, the new line is read again as the next entry */
+                rd->pos = pos;
+                rd->lineno = next;
+                entry->status = tle_eformat;
+                return true;
+            }
+            if ((len >= 2) && (line[0] == '0') && (line[1] == ' '))
+            {
+                line += 2;
+                len -= 2;
+            }
+            entry->name = line;
+            entry->namelen = len;
+            entry->lineno = lineno;
+            continue;
+        }
+
+        if (entry->name == NULL)
+        {
+            entry->lineno = lineno;
+        }
+        entry->line1 = line;
+        entry->len1 = len;
+        break;
+    }
+
+    do
+    {
+        pos = rd->pos;
+        next = rd->lineno;
+        if (!reader_line(rd, &line, &len, &lineno))
+        {
+            entry->status = tle_eformat;
+            return true;
+        }
+    } while(reader_blank(line, len));
+
+    if (!reader_isline(line, len, '2'))
+    {
+        /* Line 1 without line 2, the new line is read again as the next entry */
+        rd->pos = pos;
+        rd->lineno = next;
+        entry->status = tle_eformat;
+        return true;
+    }
+    entry->line2 = line;
+    entry->len2 = len;
+
+    if (satrec == NULL)
+    {
+        entry->status = tle_ok;
+    }
+    else
+    {
+        entry->status = twoline_init(entry->line1, entry->len1, entry->line2, entry->len2, checksum,
+                                     opsmode, whichconst, satrec);
+    }
+
+    return true;
+}
+
+size_t sgp4_reader_read(sgp4_reader_t *rd, bool checksum, char opsmode, gravconsttype whichconst,
+                        sgp4_entry_t entries[], elsetrec satrecs[], size_t max)
+{
+    sgp4_entry_t entry;
+    size_t n;
+
+    for(n = 0; n < max; n++)
+    {
+        if (!sgp4_reader_next(rd, checksum, opsmode, whichconst, (entries != NULL) ? &entries[n] : &entry,
+                              (satrecs != NULL) ? &satrecs[n] : NULL))
+        {
+            break;
+        }
+    }
+
+    return n;
+}
+
+/** \} End of sgp4reader group */
@@ -0,0 +1,330 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief SIMD propagation of near earth satellites implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4simd
+ * \{
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sgp4/sgp4simd.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define SGP4_SIMD_X86
+#endif
+
+#define SGP4_SIMD_MAXW  8   /* Widest lane count, the pack stride is a multiple of it */
+
+/* Fields of the near earth path, one array each in sgp4_pack_t.data */
+enum
+{
+    pk_jdsatepoch, pk_isimp,  pk_no,      pk_ecco,    pk_inclo,   pk_sinio,   pk_cosio,
+    pk_mo,         pk_mdot,   pk_argpo,   pk_argpdot, pk_nodeo,   pk_nodedot, pk_nodecf,
+    pk_cc1,        pk_cc4,    pk_cc5,     pk_bstar,   pk_t2cof,   pk_t3cof,   pk_t4cof,
+    pk_t5cof,      pk_omgcof, pk_eta,     pk_xmcof,   pk_delmo,   pk_sinmao,  pk_d2,
+    pk_d3,         pk_d4,     pk_aycof,   pk_xlcof,   pk_con41,   pk_x1mth2,  pk_x7thm1,
+    pk_am0,
+    pk_count
+};
+
+static void sgp4_simd_store(sgp4_soa_t *out, size_t i, double x, double y, double z,
+                            double vx, double vy, double vz, int error)
+{
+    out->x[i] = x;
+    out->y[i] = y;
+    out->z[i] = z;
+    if (out->vx != NULL)
+    {
+        out->vx[i] = vx;
+        out->vy[i] = vy;
+        out->vz[i] = vz;
+    }
+    if (out->error != NULL)
+    {
+        out->error[i] = error;
+    }
+}
+
+#ifdef SGP4_SIMD_X86
+
+/* SSE2, 2 lanes */
+typedef double sgp4_vd2 __attribute__((vector_size(16)));
+typedef long long sgp4_vl2 __attribute__((vector_size(16)));
+#define VD          sgp4_vd2
+#define VL          sgp4_vl2
+#define VW          2
+#define VFN(name)   name##_sse2
+#define VATTR       static inline __attribute__((always_inline, target("sse2")))
+#define VTARGET     static __attribute__((target("sse2")))
+#define VSQRT(x)    ((VD)_mm_sqrt_pd((__m128d)(x)))
+#include "sgp4simd_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+/* AVX2, 4 lanes */
+typedef double sgp4_vd4 __attribute__((vector_size(32)));
+typedef long long sgp4_vl4 __attribute__((vector_size(32)));
+#define VD          sgp4_vd4
+#define VL          sgp4_vl4
+#define VW          4
+#define VFN(name)   name##_avx2
+#define VATTR       static inline __attribute__((always_inline, target("avx2")))
+#define VTARGET     static __attribute__((target("avx2")))
+#define VSQRT(x)    ((VD)_mm256_sqrt_pd((__m256d)(x)))
+#include "sgp4simd_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+/* AVX-512, 8 lanes */
+typedef double sgp4_vd8 __attribute__((vector_size(64)));
+typedef long long sgp4_vl8 __attribute__((vector_size(64)));
+#define VD          sgp4_vd8
+#define VL          sgp4_vl8
+#define VW          8
+#define VFN(name)   name##_avx512
+#define VATTR       static inline __attribute__((always_inline, target("avx512f,avx512dq")))
+#define VTARGET     static __attribute__((target("avx512f,avx512dq")))
+#define VSQRT(x)    ((VD)_mm512_sqrt_pd((__m512d)(x)))
+#include "sgp4simd_kernel.h"
+#undef VD
+#undef VL
+#undef VW
+#undef VFN
+#undef VATTR
+#undef VTARGET
+#undef VSQRT
+
+#endif /* SGP4_SIMD_X86 */
+
+sgp4simdtype sgp4_simd_detect(void)
+{
+#ifdef SGP4_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+    {
+        return simd_avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return simd_avx2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return simd_sse2;
+    }
+#endif /* SGP4_SIMD_X86 */
+
+    return simd_scalar;
+}
+
+bool sgp4_pack_init(sgp4_pack_t *pack, gravconsttype whichconst, elsetrec satrecs[], size_t n)
+{
+    double tumin, mu, j3, j4, j3oj2;
+    double *f;
+    const elsetrec *s;
+    size_t i, k, last;
+
+    memset(pack, 0, sizeof(sgp4_pack_t));
+
+    pack->whichconst = whichconst;
+    pack->isa        = sgp4_simd_detect();
+    pack->satrecs    = satrecs;
+    pack->n          = n;
+
+    getgravconst(whichconst, &tumin, &mu, &pack->radiusearthkm, &pack->xke, &pack->j2, &j3, &j4, &j3oj2);
+    pack->vkmpersec = pack->radiusearthkm * pack->xke / 60.0;
+
+    for(i = 0; i < n; i++)
+    {
+        if (satrecs[i].method == 'd')
+        {
+            pack->ndeep++;
+        }
+        else
+        {
+            pack->nnear++;
+        }
+    }
+
+    pack->stride  = (pack->nnear + SGP4_SIMD_MAXW - 1) / SGP4_SIMD_MAXW * SGP4_SIMD_MAXW;
+    pack->nearidx = (size_t *)malloc((pack->nnear + 1) * sizeof(size_t));
+    pack->deepidx = (size_t *)malloc((pack->ndeep + 1) * sizeof(size_t));
+    pack->data    = (double *)malloc((pack->stride * pk_count + 1) * sizeof(double));
+
+    if ((pack->nearidx == NULL) || (pack->deepidx == NULL) || (pack->data == NULL))
+    {
+        sgp4_pack_free(pack);
+
+        return false;
+    }
+
+    pack->nnear = 0;
+    pack->ndeep = 0;
+    for(i = 0; i < n; i++)
+    {
+        if (satrecs[i].method == 'd')
+        {
+            pack->deepidx[pack->ndeep++] = i;
+        }
+        else
+        {
+            pack->nearidx[pack->nnear++] = i;
+        }
+    }
+
+    /* Padding lanes repeat the last record so they never raise spurious errors */
+    for(k = 0; k < pack->stride; k++)
+    {
+        last = k < pack->nnear ? k : pack->nnear - 1;
+        s = &satrecs[pack->nearidx[last]];
+        f = pack->data + k;
+
+        f[pk_jdsatepoch * pack->stride] = s->jdsatepoch;
+        f[pk_isimp      * pack->stride] = (double)s->isimp;
+        f[pk_no         * pack->stride] = s->no;
+        f[pk_ecco       * pack->stride] = s->ecco;
+        f[pk_inclo      * pack->stride] = s->inclo;
+        f[pk_sinio      * pack->stride] = sin(s->inclo);
+        f[pk_cosio      * pack->stride] = cos(s->inclo);
+        f[pk_mo         * pack->stride] = s->mo;
+        f[pk_mdot       * pack->stride] = s->mdot;
+        f[pk_argpo      * pack->stride] = s->argpo;
+        f[pk_argpdot    * pack->stride] = s->argpdot;
+        f[pk_nodeo      * pack->stride] = s->nodeo;
+        f[pk_nodedot    * pack->stride] = s->nodedot;
+        f[pk_nodecf     * pack->stride] = s->nodecf;
+        f[pk_cc1        * pack->stride] = s->cc1;
+        f[pk_cc4        * pack->stride] = s->cc4;
+        f[pk_cc5        * pack->stride] = s->cc5;
+        f[pk_bstar      * pack->stride] = s->bstar;
+        f[pk_t2cof      * pack->stride] = s->t2cof;
+        f[pk_t3cof      * pack->stride] = s->t3cof;
+        f[pk_t4cof      * pack->stride] = s->t4cof;
+        f[pk_t5cof      * pack->stride] = s->t5cof;
+        f[pk_omgcof     * pack->stride] = s->omgcof;
+        f[pk_eta        * pack->stride] = s->eta;
+        f[pk_xmcof      * pack->stride] = s->xmcof;
+        f[pk_delmo      * pack->stride] = s->delmo;
+        f[pk_sinmao     * pack->stride] = s->sinmao;
+        f[pk_d2         * pack->stride] = s->d2;
+        f[pk_d3         * pack->stride] = s->d3;
+        f[pk_d4         * pack->stride] = s->d4;
+        f[pk_aycof      * pack->stride] = s->aycof;
+        f[pk_xlcof      * pack->stride] = s->xlcof;
+        f[pk_con41      * pack->stride] = s->con41;
+        f[pk_x1mth2     * pack->stride] = s->x1mth2;
+        f[pk_x7thm1     * pack->stride] = s->x7thm1;
+        f[pk_am0        * pack->stride] = pow(pack->xke / s->no, 2.0 / 3.0);
+    }
+
+    return true;
+}
+
+void sgp4_pack_free(sgp4_pack_t *pack)
+{
+    free(pack->nearidx);
+    free(pack->deepidx);
+    free(pack->data);
+
+    pack->nearidx = NULL;
+    pack->deepidx = NULL;
+    pack->data    = NULL;
+    pack->nnear   = 0;
+    pack->ndeep   = 0;
+}
+
+size_t sgp4_pack_propagate(sgp4_pack_t *pack, double jd, sgp4_soa_t *out)
+{
+    double r[3], v[3];
+    elsetrec *s;
+    size_t i, nok = 0;
+    sgp4simdtype isa = pack->isa;
+
+    /* Never run a kernel the CPU does not support */
+    if (isa > sgp4_simd_detect())
+    {
+        isa = sgp4_simd_detect();
+    }
+
+    switch(isa)
+    {
+#ifdef SGP4_SIMD_X86
+        case simd_avx512:
+            nok = sgp4_simd_run_avx512(pack, jd, out);
+            break;
+        case simd_avx2:
+            nok = sgp4_simd_run_avx2(pack, jd, out);
+            break;
+        case simd_sse2:
+            nok = sgp4_simd_run_sse2(pack, jd, out);
+            break;
+#endif /* SGP4_SIMD_X86 */
+        default:
+            for(i = 0; i < pack->nnear; i++)
+            {
+                s = &pack->satrecs[pack->nearidx[i]];
+                r[0] = r[1] = r[2] = v[0] = v[1] = v[2] = NAN;
+                nok += sgp4(pack->whichconst, s, (jd - s->jdsatepoch) * 1440.0, r, v);
+                sgp4_simd_store(out, pack->nearidx[i], r[0], r[1], r[2], v[0], v[1], v[2], s->error);
+            }
+            break;
+    }
+
+    /* Deep space records always use the scalar propagator */
+    for(i = 0; i < pack->ndeep; i++)
+    {
+        s = &pack->satrecs[pack->deepidx[i]];
+        r[0] = r[1] = r[2] = v[0] = v[1] = v[2] = NAN;
+        nok += sgp4(pack->whichconst, s, (jd - s->jdsatepoch) * 1440.0, r, v);
+        sgp4_simd_store(out, pack->deepidx[i], r[0], r[1], r[2], v[0], v[1], v[2], s->error);
+    }
+
+    return nok;
+}
+
+/** \} End of sgp4simd group */
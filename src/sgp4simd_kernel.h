@@ -0,0 +1,249 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Near earth sgp4 kernel for one instruction set.
+ *
+ * Vector transcription of the method 'n' path of sgp4(), see sgp4unit_kernel.h for the scalar code
+ * and its references. Branches of the scalar code become lane masks: isimp selects which
+ * secular terms apply, the kepler iteration keeps running until every lane converged (or 10
+ * iterations) while freezing converged lanes, and each error check only sets the error code
+ * of the lanes that have no error yet.
+ *
+ * This file is a template: it has no include guard and is included once per instruction set
+ * by sgp4simd.c, which must define before including it:
+ *
+ * - VD, VL, VFN(name) and VATTR, as described in sgp4vmath.h.
+ * - VW: number of lanes.
+ * - VTARGET: attributes of the non inlined entry point.
+ * - VSQRT(x): lane-wise square root.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4simd
+ * \{
+ */
+
+#include "sgp4vmath.h"
+
+VATTR VD VFN(vload)(const sgp4_pack_t *pack, int field, size_t base)
+{
+    VD v;
+
+    memcpy(&v, pack->data + (size_t)field * pack->stride + base, sizeof(v));
+
+    return v;
+}
+
+/* Sets the error code of the lanes in m that have no error yet */
+VATTR VL VFN(vseterr)(VL err, VL m, long long code)
+{
+    return err | ((err == 0) & m & code);
+}
+
+VATTR void VFN(sgp4_simd_block)(const sgp4_pack_t *pack, size_t base, double jd, sgp4_soa_t *out, size_t *nok)
+{
+    const double twopi = 2.0 * pi;
+    VD t, xmdf, argpdf, nodedf, argpm, mm, t2, t3, t4, nodem, tempa, tempe, templ,
+       delomg, delmtemp, delm, temp, temp1, temp2, sinx, cosx, am, nm, em, xlm,
+       axnl, aynl, xl, u, eo1, tem5, tem5n, sineo1, coseo1, ecose, esine, el2, pl,
+       rl, rdotl, rvdotl, betal, sinu, cosu, su, sin2u, cos2u, mrt, xnode, xinc,
+       mvt, rvdot, sinsu, cossu, snod, cnod, sini, cosi, xmx, xmy, ux, uy, uz, vx, vy, vz,
+       sinio, cosio, con41, x1mth2, x7thm1, no, r[3], v[3];
+    VL full, active, err, nan;
+    int ktr, l, k;
+
+    t = (jd - VFN(vload)(pack, pk_jdsatepoch, base)) * 1440.0;
+    no = VFN(vload)(pack, pk_no, base);
+    full = VFN(vload)(pack, pk_isimp, base) != 1.0;
+    err = full ^ full;
+
+    /* Update for secular gravity and atmospheric drag */
+    xmdf   = VFN(vload)(pack, pk_mo, base) + VFN(vload)(pack, pk_mdot, base) * t;
+    argpdf = VFN(vload)(pack, pk_argpo, base) + VFN(vload)(pack, pk_argpdot, base) * t;
+    nodedf = VFN(vload)(pack, pk_nodeo, base) + VFN(vload)(pack, pk_nodedot, base) * t;
+    t2     = t * t;
+    nodem  = nodedf + VFN(vload)(pack, pk_nodecf, base) * t2;
+    tempa  = 1.0 - VFN(vload)(pack, pk_cc1, base) * t;
+    tempe  = VFN(vload)(pack, pk_bstar, base) * VFN(vload)(pack, pk_cc4, base) * t;
+    templ  = VFN(vload)(pack, pk_t2cof, base) * t2;
+
+    /* Terms of the lanes with isimp != 1 */
+    delomg   = VFN(vload)(pack, pk_omgcof, base) * t;
+    VFN(vsincos)(xmdf, &sinx, &cosx);
+    delmtemp = 1.0 + VFN(vload)(pack, pk_eta, base) * cosx;
+    delm     = VFN(vload)(pack, pk_xmcof, base) *
+               (delmtemp * delmtemp * delmtemp - VFN(vload)(pack, pk_delmo, base));
+    temp     = delomg + delm;
+    mm       = VFN(vsel)(full, xmdf + temp, xmdf);
+    argpm    = VFN(vsel)(full, argpdf - temp, argpdf);
+    t3       = t2 * t;
+    t4       = t3 * t;
+    tempa    = VFN(vsel)(full, tempa - VFN(vload)(pack, pk_d2, base) * t2 -
+                               VFN(vload)(pack, pk_d3, base) * t3 -
+                               VFN(vload)(pack, pk_d4, base) * t4, tempa);
+    VFN(vsincos)(mm, &sinx, &cosx);
+    tempe    = VFN(vsel)(full, tempe + VFN(vload)(pack, pk_bstar, base) * VFN(vload)(pack, pk_cc5, base) *
+                               (sinx - VFN(vload)(pack, pk_sinmao, base)), tempe);
+    templ    = VFN(vsel)(full, templ + VFN(vload)(pack, pk_t3cof, base) * t3 +
+                               t4 * (VFN(vload)(pack, pk_t4cof, base) + t * VFN(vload)(pack, pk_t5cof, base)), templ);
+
+    err = VFN(vseterr)(err, no <= 0.0, 2);
+
+    /* pow(xke / no, 2 / 3) is constant for near earth orbits */
+    am = VFN(vload)(pack, pk_am0, base) * tempa * tempa;
+    nm = pack->xke / (am * VSQRT(am));
+    em = VFN(vload)(pack, pk_ecco, base) - tempe;
+
+    err = VFN(vseterr)(err, (em >= 1.0) | (em < -0.001), 1);
+    em  = VFN(vsel)(em < 1.0e-6, VFN(vsplat)(1.0e-6), em);
+
+    mm    = mm + no * templ;
+    xlm   = mm + argpm + nodem;
+    nodem = VFN(vfloatmod)(nodem, twopi);
+    argpm = VFN(vfloatmod)(argpm, twopi);
+    xlm   = VFN(vfloatmod)(xlm, twopi);
+    mm    = VFN(vfloatmod)(xlm - argpm - nodem, twopi);
+
+    /* Long period periodics */
+    sinio = VFN(vload)(pack, pk_sinio, base);
+    cosio = VFN(vload)(pack, pk_cosio, base);
+    VFN(vsincos)(argpm, &sinx, &cosx);
+    axnl = em * cosx;
+    temp = 1.0 / (am * (1.0 - em * em));
+    aynl = em * sinx + temp * VFN(vload)(pack, pk_aycof, base);
+    xl   = mm + argpm + nodem + temp * VFN(vload)(pack, pk_xlcof, base) * axnl;
+
+    /* Solve kepler's equation, converged lanes are frozen */
+    u      = VFN(vfloatmod)(xl - nodem, twopi);
+    eo1    = u;
+    tem5   = VFN(vsplat)(9999.9);
+    sineo1 = VFN(vsplat)(0.0);
+    coseo1 = VFN(vsplat)(0.0);
+    for(ktr = 1; ktr <= 10; ktr++)
+    {
+        active = VFN(vabs)(tem5) >= 1.0e-12;
+        for(k = 0, l = 0; l < VW; l++)
+        {
+            k |= (active[l] != 0);
+        }
+        if (k == 0)
+        {
+            break;
+        }
+        VFN(vsincos)(eo1, &sinx, &cosx);
+        sineo1 = VFN(vsel)(active, sinx, sineo1);
+        coseo1 = VFN(vsel)(active, cosx, coseo1);
+        tem5n  = 1.0 - cosx * axnl - sinx * aynl;
+        tem5n  = (u - aynl * cosx + axnl * sinx - eo1) / tem5n;
+        tem5n  = VFN(vsel)(VFN(vabs)(tem5n) >= 0.95,
+                           VFN(vsel)(tem5n > 0.0, VFN(vsplat)(0.95), VFN(vsplat)(-0.95)), tem5n);
+        tem5   = VFN(vsel)(active, tem5n, tem5);
+        eo1    = VFN(vsel)(active, eo1 + tem5n, eo1);
+    }
+
+    /* Short period preliminary quantities */
+    ecose = axnl * coseo1 + aynl * sineo1;
+    esine = axnl * sineo1 - aynl * coseo1;
+    el2   = axnl * axnl + aynl * aynl;
+    pl    = am * (1.0 - el2);
+    err   = VFN(vseterr)(err, pl < 0.0, 4);
+
+    rl     = am * (1.0 - ecose);
+    rdotl  = VSQRT(am) * esine / rl;
+    rvdotl = VSQRT(pl) / rl;
+    betal  = VSQRT(1.0 - el2);
+    temp   = esine / (1.0 + betal);
+    sinu   = am / rl * (sineo1 - aynl - axnl * temp);
+    cosu   = am / rl * (coseo1 - axnl + aynl * temp);
+    su     = VFN(vatan2)(sinu, cosu);
+    sin2u  = (cosu + cosu) * sinu;
+    cos2u  = 1.0 - 2.0 * sinu * sinu;
+    temp   = 1.0 / pl;
+    temp1  = 0.5 * pack->j2 * temp;
+    temp2  = temp1 * temp;
+
+    /* Update for short period periodics */
+    con41  = VFN(vload)(pack, pk_con41, base);
+    x1mth2 = VFN(vload)(pack, pk_x1mth2, base);
+    x7thm1 = VFN(vload)(pack, pk_x7thm1, base);
+    mrt    = rl * (1.0 - 1.5 * temp2 * betal * con41) + 0.5 * temp1 * x1mth2 * cos2u;
+    su     = su - 0.25 * temp2 * x7thm1 * sin2u;
+    xnode  = nodem + 1.5 * temp2 * cosio * sin2u;
+    xinc   = VFN(vload)(pack, pk_inclo, base) + 1.5 * temp2 * cosio * sinio * cos2u;
+    mvt    = rdotl - nm * temp1 * x1mth2 * sin2u / pack->xke;
+    rvdot  = rvdotl + nm * temp1 * (x1mth2 * cos2u + 1.5 * con41) / pack->xke;
+
+    /* Orientation vectors */
+    VFN(vsincos)(su, &sinsu, &cossu);
+    VFN(vsincos)(xnode, &snod, &cnod);
+    VFN(vsincos)(xinc, &sini, &cosi);
+    xmx = -snod * cosi;
+    xmy =  cnod * cosi;
+    ux  =  xmx * sinsu + cnod * cossu;
+    uy  =  xmy * sinsu + snod * cossu;
+    uz  =  sini * sinsu;
+    vx  =  xmx * cossu - cnod * sinsu;
+    vy  =  xmy * cossu - snod * sinsu;
+    vz  =  sini * cossu;
+
+    /* Position and velocity (in km and km/sec), nan for errors 1, 2 and 4 */
+    err  = VFN(vseterr)(err, mrt < 1.0, 6);
+    nan  = (err != 0) & (err != 6);
+    r[0] = VFN(vsel)(nan, VFN(vsplat)(NAN), (mrt * ux) * pack->radiusearthkm);
+    r[1] = VFN(vsel)(nan, VFN(vsplat)(NAN), (mrt * uy) * pack->radiusearthkm);
+    r[2] = VFN(vsel)(nan, VFN(vsplat)(NAN), (mrt * uz) * pack->radiusearthkm);
+    v[0] = VFN(vsel)(nan, VFN(vsplat)(NAN), (mvt * ux + rvdot * vx) * pack->vkmpersec);
+    v[1] = VFN(vsel)(nan, VFN(vsplat)(NAN), (mvt * uy + rvdot * vy) * pack->vkmpersec);
+    v[2] = VFN(vsel)(nan, VFN(vsplat)(NAN), (mvt * uz + rvdot * vz) * pack->vkmpersec);
+
+    /* Scatter the lanes back to the source order, padding lanes are dropped */
+    for(l = 0; l < VW && base + l < pack->nnear; l++)
+    {
+        sgp4_simd_store(out, pack->nearidx[base + l], r[0][l], r[1][l], r[2][l],
+                        v[0][l], v[1][l], v[2][l], (int)err[l]);
+        *nok += (err[l] == 0);
+    }
+}
+
+VTARGET size_t VFN(sgp4_simd_run)(const sgp4_pack_t *pack, double jd, sgp4_soa_t *out)
+{
+    size_t base, nok = 0;
+
+    for(base = 0; base < pack->nnear; base += VW)
+    {
+        VFN(sgp4_simd_block)(pack, base, jd, out, &nok);
+    }
+
+    return nok;
+}
+
+/** \} End of sgp4simd group */
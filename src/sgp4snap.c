@@ -0,0 +1,220 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Binary snapshots of initialised catalogs implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4snap
+ * \{
+ */
+
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE 700   /* mkstemp, fchmod and fsync */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <sgp4/sgp4snap.h>
+
+#define SGP4_SNAP_MAGIC     "SGPS"
+#define SGP4_SNAP_VERSION   1
+#define SGP4_SNAP_ENDIAN    0x01020304u     /* Reads back as 0x04030201 with the other byte order */
+
+#define FNV_OFFSET  0xcbf29ce484222325ull
+#define FNV_PRIME   0x100000001b3ull
+
+/* Hashes one line up to its end of line, then a zero byte as separator */
+static uint64_t snap_hashline(uint64_t h, const char *line)
+{
+    for(; (*line != '\0') && (*line != '\r') && (*line != '\n'); line++)
+    {
+        h = (h ^ (uint8_t)*line) * FNV_PRIME;
+    }
+
+    return h * FNV_PRIME;
+}
+
+uint64_t sgp4_snap_hash(const char *const line1[], const char *const line2[], size_t n)
+{
+    uint64_t h = FNV_OFFSET;
+    size_t i;
+
+    for(i = 0; i < n; i++)
+    {
+        h = snap_hashline(h, line1[i]);
+        h = snap_hashline(h, line2[i]);
+    }
+
+    return h;
+}
+
+bool sgp4_snap_save(const char *path, gravconsttype whichconst, char opsmode, uint64_t hash,
+                    const elsetrec satrecs[], size_t n)
+{
+    sgp4_snap_header_t header;
+    char *tmp;
+    FILE *f;
+    bool ok;
+    int fd;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SGP4_SNAP_MAGIC, 4);
+    header.version    = SGP4_SNAP_VERSION;
+    header.endian     = SGP4_SNAP_ENDIAN;
+    header.recsize    = sizeof(elsetrec);
+    header.whichconst = whichconst;
+    header.opsmode    = opsmode;
+    header.count      = n;
+    header.hash       = hash;
+
+    /* Unique temporary name next to path, so concurrent saves never share it */
+    tmp = malloc(strlen(path) + 8);
+    if (tmp == NULL)
+    {
+        return false;
+    }
+    strcpy(tmp, path);
+    strcat(tmp, ".XXXXXX");
+
+    fd = mkstemp(tmp);
+    if (fd < 0)
+    {
+        free(tmp);
+        return false;
+    }
+    f = fdopen(fd, "wb");
+    if (f == NULL)
+    {
+        close(fd);
+        remove(tmp);
+        free(tmp);
+        return false;
+    }
+
+    ok = (fchmod(fd, 0644) == 0) &&     /* mkstemp creates it 0600 */
+         (fwrite(&header, sizeof(header), 1, f) == 1) &&
+         (fwrite(satrecs, sizeof(elsetrec), n, f) == n);
+    ok = ok && (fflush(f) == 0) && (fsync(fd) == 0);    /* Complete on disk before the rename */
+    ok = (fclose(f) == 0) && ok;
+    ok = ok && (rename(tmp, path) == 0);
+    if (!ok)
+    {
+        remove(tmp);
+    }
+    free(tmp);
+
+    return ok;
+}
+
+sgp4snapstatus sgp4_snap_open(const char *path, gravconsttype whichconst, char opsmode, uint64_t hash,
+                              sgp4_snap_t *snap)
+{
+    const sgp4_snap_header_t *header;
+    struct stat st;
+    sgp4snapstatus status;
+    void *map;
+    int fd;
+
+    memset(snap, 0, sizeof(*snap));
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return snap_eio;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return snap_eio;
+    }
+    if ((size_t)st.st_size < sizeof(sgp4_snap_header_t))
+    {
+        close(fd);
+        return snap_eformat;
+    }
+
+    /* Private and writable, so sgp4() can update the records without touching the file */
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return snap_eio;
+    }
+
+    header = (const sgp4_snap_header_t *)map;
+    if ((memcmp(header->magic, SGP4_SNAP_MAGIC, 4) != 0) || (header->version != SGP4_SNAP_VERSION) ||
+        (header->endian != SGP4_SNAP_ENDIAN) || (header->recsize != sizeof(elsetrec)) ||
+        (header->count > ((size_t)st.st_size - sizeof(sgp4_snap_header_t)) / sizeof(elsetrec)) ||
+        ((size_t)st.st_size != sizeof(sgp4_snap_header_t) + header->count * sizeof(elsetrec)))
+    {
+        status = snap_eformat;
+    }
+    else if ((header->whichconst != (int32_t)whichconst) || (header->opsmode != opsmode) || (header->hash != hash))
+    {
+        status = snap_estale;
+    }
+    else
+    {
+        status = snap_ok;
+    }
+
+    if (status != snap_ok)
+    {
+        munmap(map, (size_t)st.st_size);
+        return status;
+    }
+
+    snap->satrecs = (elsetrec *)((char *)map + sizeof(sgp4_snap_header_t));
+    snap->n       = (size_t)header->count;
+    snap->map     = map;
+    snap->maplen  = (size_t)st.st_size;
+
+    return snap_ok;
+}
+
+void sgp4_snap_close(sgp4_snap_t *snap)
+{
+    if (snap->map != NULL)
+    {
+        munmap(snap->map, snap->maplen);
+    }
+    memset(snap, 0, sizeof(*snap));
+}
+
+/** \} End of sgp4snap group */
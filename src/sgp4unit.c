@@ -98,6 +98,20 @@
 const char help = 'n';
 FILE *dbgfile;
 
+/* ----------- gravity constants used by sgp4, resolved once per model ---------- */
+typedef struct
+{
+    double radiusearthkm, xke, j2, j3oj2, vkmpersec;
+} sgp4consts;
+
+/* flatten inlines the whole call tree (gravity constants, dpper, dspace) into each
+   specialised propagator, so the constant arguments fold away */
+#if defined(__GNUC__)
+#define SGP4_SPECIALISE static __attribute__((flatten))
+#else
+#define SGP4_SPECIALISE static
+#endif
+
 /* ----------- local functions - only ever used internally by sgp4 ---------- */
 static void dpper(double e3,    double ee2,     double peo,     double pgho,    double pho,
                   double pinco, double plo,     double se2,     double se3,     double sgh2,
@@ -158,6 +172,28 @@ static void dspace(int irez,
                    double &atime,   double &em,     double &argpm,  double &inclm, double &xli,
                    double &mm,      double &xni,    double &nodem,  double &dndt,  double &nm);
 
+static void sgp4_getconsts(gravconsttype whichconst, sgp4consts *consts);
+
+static bool sgp4_propagate(const sgp4consts *consts, elsetrec *satrec, double tsince, double r[3], double v[3]);
+
+static bool sgp4_propagate_variant(elsetrec *satrec, double tsince, double r[3], double v[3]);
+
+static bool sgp4_core(const sgp4consts *consts, const elsetrec *satrec, sgp4_ctx_t *ctx,
+                      double tsince, double r[3], double v[3]);
+
+static int sgp4_kind(const elsetrec *satrec);
+static bool sgp4_variantok(const elsetrec *satrec);
+static bool sgp4_variantfor(gravconsttype whichconst, const elsetrec *satrec);
+
+static int sgp4_variant(gravconsttype whichconst, const elsetrec *satrec);
+
+static void sgp4_ctx_load(sgp4_ctx_t *ctx, const elsetrec *satrec);
+
+static void sgp4_ctx_save(elsetrec *satrec, const sgp4_ctx_t *ctx);
+
+static bool sgp4_store(gravconsttype whichconst, const sgp4consts *consts, elsetrec *satrec, double tsince,
+                       sgp4_soa_t *out, size_t i);
+
 static void initl(int satn,         gravconsttype whichconst,
                   double ecco,      double epoch,   double inclo,   double &no,
                   char &method,
@@ -165,6 +201,17 @@ static void initl(int satn,         gravconsttype whichconst,
                   double &cosio2,   double &eccsq,  double &omeosq, double &posq,
                   double &rp,       double &rteosq, double &sinio , double &gsto,   char opsmode);
 
+/* The sgp4 equations, shared with sgp4compact.c */
+#define SGP4_KERNEL_FN      sgp4_kernel
+#define SGP4_KERNEL_REC     elsetrec
+#define SGP4_KERNEL_CONSTS  sgp4consts
+#define SGP4_KERNEL_DEEP    1
+#include "sgp4unit_kernel.h"
+#undef SGP4_KERNEL_FN
+#undef SGP4_KERNEL_REC
+#undef SGP4_KERNEL_CONSTS
+#undef SGP4_KERNEL_DEEP
+
 /* -----------------------------------------------------------------------------
 *
 *                           procedure dpper
@@ -1625,6 +1672,9 @@ bool sgp4init(gravconsttype whichconst, char opsmode,   const int satn,     cons
        }
     }
 
+    /* Select the specialised propagator once the method is known */
+    satrec->variant = sgp4_variant(whichconst, satrec);
+
        /* finally propogate to zero epoch to initialize all others. */
        // sgp4fix take out check to let satellites process until they are actually below earth surface
 //       if(satrec->error == 0)
@@ -1725,279 +1775,396 @@ bool sgp4init(gravconsttype whichconst, char opsmode,   const int satn,     cons
 
 bool sgp4(gravconsttype whichconst, elsetrec *satrec, double tsince, double r[3], double v[3])
 {
-    double am,      axnl,   aynl,   betal,  cosim , cnod,
-           cos2u,   coseo1, cosi,   cosip,  cosisq, cossu,  cosu,
-           delm,    delomg, em,     emsq,   ecose,  el2,    eo1 ,
-           ep,      esine,  argpm,  argpp,  argpdf, pl,     mrt = 0.0,
-           mvt,     rdotl,  rl,     rvdot,  rvdotl, sinim,
-           sin2u,   sineo1, sini,   sinip,  sinsu,  sinu,
-           snod,    su,     t2,     t3,     t4,     tem5,   temp,
-           temp1,   temp2,  tempa,  tempe,  templ,  u,      ux,
-           uy,      uz,     vx,     vy,     vz,     inclm,  mm,
-           nm,      nodem,  xinc,   xincp,  xl,     xlm,    mp,
-           xmdf,    xmx,    xmy,    nodedf, xnode,  nodep,  tc,     dndt,
-           twopi,   x2o3,   j2,     j3,     tumin,  j4,     xke,    j3oj2, radiusearthkm,
-           mu,      vkmpersec, delmtemp;
-    int ktr;
-
-    /* Set mathematical constants */
-    // sgp4fix divisor for divide by zero check on inclination
-    // the old check used 1.0 + cos(pi-1.0e-9), but then compared it to
-    // 1.5 e-12, so the threshold was changed to 1.5e-12 for consistency
-    const double temp4 =   1.5e-12;
-    twopi = 2.0 * pi;
-    x2o3  = 2.0 / 3.0;
-    /* sgp4fix identify constants and allow alternate values */
-    getgravconst(whichconst, &tumin, &mu, &radiusearthkm, &xke, &j2, &j3, &j4, &j3oj2);
-    vkmpersec = radiusearthkm * xke/60.0;
-
-    /* Clear sgp4 error flag */
-    satrec->t       = tsince;
-    satrec->error   = 0;
-
-    /* Update for secular gravity and atmospheric drag */
-    xmdf    = satrec->mo + satrec->mdot * satrec->t;
-    argpdf  = satrec->argpo + satrec->argpdot * satrec->t;
-    nodedf  = satrec->nodeo + satrec->nodedot * satrec->t;
-    argpm   = argpdf;
-    mm      = xmdf;
-    t2      = satrec->t * satrec->t;
-    nodem   = nodedf + satrec->nodecf * t2;
-    tempa   = 1.0 - satrec->cc1 * satrec->t;
-    tempe   = satrec->bstar * satrec->cc4 * satrec->t;
-    templ   = satrec->t2cof * t2;
-
-    if (satrec->isimp != 1)
+    sgp4consts consts;
+
+    /* Records initialised with the same constants use their specialised propagator */
+    if (sgp4_variantfor(whichconst, satrec))
     {
-        delomg = satrec->omgcof * satrec->t;
-        /* sgp4fix use mutliply for speed instead of pow */
-        delmtemp =  1.0 + satrec->eta * cos(xmdf);
-        delm   = satrec->xmcof *
-                 (delmtemp * delmtemp * delmtemp -
-                 satrec->delmo);
-        temp   = delomg + delm;
-        mm     = xmdf + temp;
-        argpm  = argpdf - temp;
-        t3     = t2 * satrec->t;
-        t4     = t3 * satrec->t;
-        tempa  = tempa - satrec->d2 * t2 - satrec->d3 * t3 -
-                         satrec->d4 * t4;
-        tempe  = tempe + satrec->bstar * satrec->cc5 * (sin(mm) -
-                         satrec->sinmao);
-        templ  = templ + satrec->t3cof * t3 + t4 * (satrec->t4cof +
-                         satrec->t * satrec->t5cof);
+        return sgp4_propagate_variant(satrec, tsince, r, v);
     }
 
-    nm    = satrec->no;
-    em    = satrec->ecco;
-    inclm = satrec->inclo;
-    if (satrec->method == 'd')
-    {
-        tc = satrec->t;
-        dspace(satrec->irez,
-               satrec->d2201, satrec->d2211, satrec->d3210,
-               satrec->d3222, satrec->d4410, satrec->d4422,
-               satrec->d5220, satrec->d5232, satrec->d5421,
-               satrec->d5433, satrec->dedt,  satrec->del1,
-               satrec->del2,  satrec->del3,  satrec->didt,
-               satrec->dmdt,  satrec->dnodt, satrec->domdt,
-               satrec->argpo, satrec->argpdot, satrec->t, tc,
-               satrec->gsto, satrec->xfact, satrec->xlamo,
-               satrec->no, satrec->atime,
-               em, argpm, inclm, satrec->xli, mm, satrec->xni,
-               nodem, dndt, nm);
+    sgp4_getconsts(whichconst, &consts);
+
+    return sgp4_propagate(&consts, satrec, tsince, r, v);
+}
+
+/*-----------------------------------------------------------------------------
+*
+*                             procedure sgp4_propagate
+*
+*  this procedure is the body of sgp4 with the gravity constants already
+*    resolved, so callers propagating many records with the same model look
+*    them up only once. the record is updated exactly as the original sgp4
+*    did, through a context loaded from and saved back to it.
+*
+*  inputs        :
+*    consts      - constants filled by sgp4_getconsts
+*    satrec      - initialised structure from sgp4init() call.
+*    tsince      - time since epoch (minutes)
+*
+*  outputs       :
+*    r           - position vector                     km
+*    v           - velocity                            km/sec
+*
+*  coupling      :
+*    sgp4_core
+  ----------------------------------------------------------------------------*/
+
+static bool sgp4_propagate(const sgp4consts *consts, elsetrec *satrec, double tsince, double r[3], double v[3])
+{
+    sgp4_ctx_t ctx;
+    bool ok;
+
+    sgp4_ctx_load(&ctx, satrec);
+
+    ok = sgp4_core(consts, satrec, &ctx, tsince, r, v);
+
+    sgp4_ctx_save(satrec, &ctx);
+
+    return ok;
+}
+
+/* Integrator state in, everything sgp4 used to write back to the record out */
+static void sgp4_ctx_load(sgp4_ctx_t *ctx, const elsetrec *satrec)
+{
+    ctx->atime = satrec->atime;
+    ctx->xli   = satrec->xli;
+    ctx->xni   = satrec->xni;
+}
+
+static void sgp4_ctx_save(elsetrec *satrec, const sgp4_ctx_t *ctx)
+{
+    satrec->t      = ctx->t;
+    satrec->error  = ctx->error;
+    satrec->atime  = ctx->atime;
+    satrec->xli    = ctx->xli;
+    satrec->xni    = ctx->xni;
+    satrec->aycof  = ctx->aycof;
+    satrec->xlcof  = ctx->xlcof;
+    satrec->con41  = ctx->con41;
+    satrec->x1mth2 = ctx->x1mth2;
+    satrec->x7thm1 = ctx->x7thm1;
+}
+
+/*-----------------------------------------------------------------------------
+*
+*                             procedure sgp4_ctx_init
+*
+*  this procedure resets a propagation context so the next sgp4_r call
+*    restarts the resonance integrator from epoch.
+*
+*  inputs        :
+*    ctx         - context to reset
+  ----------------------------------------------------------------------------*/
+
+void sgp4_ctx_init(sgp4_ctx_t *ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+/*-----------------------------------------------------------------------------
+*
+*                             procedure sgp4_r
+*
+*  this procedure is the reentrant form of sgp4. the record is only read;
+*    the time, error code, per-call scratch and the deep space resonance
+*    integrator state live in the caller's context. a record can then be
+*    shared by any number of threads, each using its own context.
+*
+*  inputs        :
+*    whichconst  - which set of constants to use  wgs72old, wgs72, wgs84
+*    satrec      - initialised structure from sgp4init() call.
+*    ctx         - context reset by sgp4_ctx_init, or used before with the
+*                  same record
+*    tsince      - time since epoch (minutes)
+*
+*  outputs       :
+*    ctx         - t, error and integrator state updated
+*    r           - position vector                     km
+*    v           - velocity                            km/sec
+*
+*  coupling      :
+*    sgp4_core
+  ----------------------------------------------------------------------------*/
+
+bool sgp4_r(gravconsttype whichconst, const elsetrec *satrec, sgp4_ctx_t *ctx, double tsince, double r[3], double v[3])
+{
+    sgp4consts consts;
+
+    sgp4_getconsts(whichconst, &consts);
+
+    return sgp4_core(&consts, satrec, ctx, tsince, r, v);
+}
+
+/*-----------------------------------------------------------------------------
+*
+*                             specialised propagators
+*
+*  one propagator per gravity model and kind of record, generated from
+*    sgp4_kernel with the constants, kind and opsmode as literals. the
+*    table is indexed by the variant sgp4init stores in the record:
+*    whichconst * sgp4_kinds + kind.
+  ----------------------------------------------------------------------------*/
+
+typedef bool (*sgp4variantfn)(const elsetrec *satrec, sgp4_ctx_t *ctx, double tsince, double r[3], double v[3]);
+
+#define SGP4_VARIANT(grav, kind, opsmode)                                                   \
+    SGP4_SPECIALISE bool sgp4_##grav##_##kind(const elsetrec *satrec, sgp4_ctx_t *ctx,      \
+                                              double tsince, double r[3], double v[3])      \
+    {                                                                                       \
+        sgp4consts consts;                                                                  \
+                                                                                            \
+        sgp4_getconsts(grav, &consts);                                                      \
+                                                                                            \
+        return sgp4_kernel(&consts, satrec, ctx, tsince, r, v, sgp4_##kind, opsmode);       \
     }
 
-    if (nm <= 0.0)
+#define SGP4_VARIANTS(grav)                     \
+    SGP4_VARIANT(grav, near_full,     'i')      \
+    SGP4_VARIANT(grav, near_simple,   'i')      \
+    SGP4_VARIANT(grav, deep_afspc,    'a')      \
+    SGP4_VARIANT(grav, deep_improved, 'i')
+
+SGP4_VARIANTS(wgs72old)
+SGP4_VARIANTS(wgs72)
+SGP4_VARIANTS(wgs84)
+
+#define SGP4_VARIANT_ENTRIES(grav)                                      \
+    sgp4_##grav##_near_full,    sgp4_##grav##_near_simple,              \
+    sgp4_##grav##_deep_afspc,   sgp4_##grav##_deep_improved
+
+static const sgp4variantfn sgp4_variants[] =
+{
+    SGP4_VARIANT_ENTRIES(wgs72old),
+    SGP4_VARIANT_ENTRIES(wgs72),
+    SGP4_VARIANT_ENTRIES(wgs84)
+};
+
+#undef SGP4_VARIANT_ENTRIES
+#undef SGP4_VARIANTS
+#undef SGP4_VARIANT
+
+/*-----------------------------------------------------------------------------
+*
+*                             function sgp4_variant
+*
+*  this function picks the specialised propagator of an initialised record.
+  ----------------------------------------------------------------------------*/
+
+static int sgp4_variant(gravconsttype whichconst, const elsetrec *satrec)
+{
+    return (int)whichconst * sgp4_kinds + sgp4_kind(satrec);
+}
+
+/* True when the variant of the record is in the table and matches its kind (false for
+   records not initialised by sgp4init, e.g. zeroed or filled by hand) */
+static bool sgp4_variantok(const elsetrec *satrec)
+{
+    return (satrec->variant >= 0) && (satrec->variant < (int)(sizeof(sgp4_variants) / sizeof(sgp4_variants[0]))) &&
+           (satrec->variant % sgp4_kinds == sgp4_kind(satrec));
+}
+
+/* True when the variant of the record is in the table and uses the gravity model of the
+   call. The kind is trusted, as sgp4init sets it together with method, isimp and opsmode */
+static bool sgp4_variantfor(gravconsttype whichconst, const elsetrec *satrec)
+{
+    return (satrec->variant >= 0) && (satrec->variant < (int)(sizeof(sgp4_variants) / sizeof(sgp4_variants[0]))) &&
+           (satrec->variant / sgp4_kinds == (int)whichconst);
+}
+
+/* Runs the specialised propagator of a checked record, updating the record like sgp4 */
+static bool sgp4_propagate_variant(elsetrec *satrec, double tsince, double r[3], double v[3])
+{
+    sgp4_ctx_t ctx;
+    bool ok;
+
+    sgp4_ctx_load(&ctx, satrec);
+
+    ok = sgp4_variants[satrec->variant](satrec, &ctx, tsince, r, v);
+
+    sgp4_ctx_save(satrec, &ctx);
+
+    return ok;
+}
+
+/*-----------------------------------------------------------------------------
+*
+*                             procedure sgp4_fast
+*
+*  this procedure propagates a record with the specialised propagator chosen
+*    by sgp4init, updating the record like sgp4. a record whose variant is not
+*    the one sgp4init would choose is not propagated, with error code 7.
+  ----------------------------------------------------------------------------*/
+
+bool sgp4_fast(elsetrec *satrec, double tsince, double r[3], double v[3])
+{
+    if (!sgp4_variantok(satrec))
     {
-        satrec->error = 2;
-        /* sgp4fix add return */
+        satrec->error = 7;
         return false;
     }
-    am = pow((xke / nm), x2o3) * tempa * tempa;
-    nm = xke / pow(am, 1.5);
-    em = em - tempe;
 
-    /* fix tolerance for error recognition */
-    /* sgp4fix am is fixed from the previous nm check */
-    if ((em >= 1.0) || (em < -0.001)/* || (am < 0.95)*/ )
+    return sgp4_propagate_variant(satrec, tsince, r, v);
+}
+
+/*-----------------------------------------------------------------------------
+*
+*                             procedure sgp4_fast_r
+*
+*  reentrant form of sgp4_fast, see sgp4_r.
+  ----------------------------------------------------------------------------*/
+
+bool sgp4_fast_r(const elsetrec *satrec, sgp4_ctx_t *ctx, double tsince, double r[3], double v[3])
+{
+    if (!sgp4_variantok(satrec))
     {
-        satrec->error = 1;
-        // sgp4fix to return if there is an error in eccentricity
+        ctx->error = 7;
         return false;
     }
-    /* sgp4fix fix tolerance to avoid a divide by zero */
-    if (em < 1.0e-6)
-    {
-        em  = 1.0e-6;
-    }
-    mm     = mm + satrec->no * templ;
-    xlm    = mm + argpm + nodem;
-    emsq   = em * em;
-    temp   = 1.0 - emsq;
-
-    nodem  = floatmod(nodem, twopi);
-    argpm  = floatmod(argpm, twopi);
-    xlm    = floatmod(xlm, twopi);
-    mm     = floatmod(xlm - argpm - nodem, twopi);
-
-    /* Compute extra mean quantities */
-    sinim = sin(inclm);
-    cosim = cos(inclm);
-
-    /* Add lunar-solar periodics */
-    ep     = em;
-    xincp  = inclm;
-    argpp  = argpm;
-    nodep  = nodem;
-    mp     = mm;
-    sinip  = sinim;
-    cosip  = cosim;
+
+    return sgp4_variants[satrec->variant](satrec, ctx, tsince, r, v);
+}
+
+/* Kind of record, from the method, isimp and opsmode set by sgp4init */
+static int sgp4_kind(const elsetrec *satrec)
+{
     if (satrec->method == 'd')
     {
-        dpper(satrec->e3,   satrec->ee2,  satrec->peo,
-              satrec->pgho, satrec->pho,  satrec->pinco,
-              satrec->plo,  satrec->se2,  satrec->se3,
-              satrec->sgh2, satrec->sgh3, satrec->sgh4,
-              satrec->sh2,  satrec->sh3,  satrec->si2,
-              satrec->si3,  satrec->sl2,  satrec->sl3,
-              satrec->sl4,  satrec->t,    satrec->xgh2,
-              satrec->xgh3, satrec->xgh4, satrec->xh2,
-              satrec->xh3,  satrec->xi2,  satrec->xi3,
-              satrec->xl2,  satrec->xl3,  satrec->xl4,
-              satrec->zmol, satrec->zmos, satrec->inclo,
-              'n', ep, xincp, nodep, argpp, mp, satrec->operationmode);
-        if (xincp < 0.0)
-        {
-            xincp  = -xincp;
-            nodep = nodep + pi;
-            argpp  = argpp - pi;
-        }
-        if ((ep < 0.0 ) || ( ep > 1.0))
-        {
-            satrec->error = 3;
-            /* sgp4fix add return */
-            return false;
-        }
+        return satrec->operationmode == 'a' ? sgp4_deep_afspc : sgp4_deep_improved;
     }
 
-    /* Long period periodics */
-    if (satrec->method == 'd')
+    return satrec->isimp == 1 ? sgp4_near_simple : sgp4_near_full;
+}
+
+/*-----------------------------------------------------------------------------
+*
+*                             procedure sgp4_core
+*
+*  this procedure runs the sgp4 equations for any kind of record, testing
+*    the method, isimp and opsmode of the record at runtime.
+*
+*  inputs        :
+*    consts      - constants filled by sgp4_getconsts
+*    satrec      - initialised structure from sgp4init() call.
+*    ctx         - atime, xli, xni of the resonance integrator
+*    tsince      - time since epoch (minutes)
+*
+*  outputs       :
+*    ctx         - t, error, integrator state and scratch
+*    r           - position vector                     km
+*    v           - velocity                            km/sec
+*
+*  coupling      :
+*    sgp4_kernel
+  ----------------------------------------------------------------------------*/
+
+static bool sgp4_core(const sgp4consts *consts, const elsetrec *satrec, sgp4_ctx_t *ctx,
+                      double tsince, double r[3], double v[3])
+{
+    return sgp4_kernel(consts, satrec, ctx, tsince, r, v, sgp4_kind(satrec), satrec->operationmode);
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure sgp4_store
+*
+*  this procedure propagates one record and writes the result to index i of
+*    the batch output buffers. the velocity and error buffers are optional.
+*    records initialised with whichconst use their specialised propagator,
+*    the others the generic path with consts, as in sgp4.
+  --------------------------------------------------------------------------- */
+
+static bool sgp4_store(gravconsttype whichconst, const sgp4consts *consts, elsetrec *satrec, double tsince,
+                       sgp4_soa_t *out, size_t i)
+{
+    double r[3] = {NAN, NAN, NAN};
+    double v[3] = {NAN, NAN, NAN};
+    bool ok;
+
+    if (sgp4_variantfor(whichconst, satrec))
     {
-        sinip =  sin(xincp);
-        cosip =  cos(xincp);
-        satrec->aycof = -0.5*j3oj2*sinip;
-        /* sgp4fix for divide by zero for xincp = 180 deg */
-        if (fabs(cosip+1.0) > 1.5e-12)
-        {
-            satrec->xlcof = -0.25 * j3oj2 * sinip * (3.0 + 5.0 * cosip) / (1.0 + cosip);
-        }
-        else
-        {
-            satrec->xlcof = -0.25 * j3oj2 * sinip * (3.0 + 5.0 * cosip) / temp4;
-        }
+        ok = sgp4_propagate_variant(satrec, tsince, r, v);
     }
-    axnl = ep * cos(argpp);
-    temp = 1.0 / (am * (1.0 - ep * ep));
-    aynl = ep* sin(argpp) + temp * satrec->aycof;
-    xl   = mp + argpp + nodep + temp * satrec->xlcof * axnl;
-
-    /* Solve kepler's equation */
-    u    = floatmod(xl - nodep, twopi);
-    eo1  = u;
-    tem5 = 9999.9;
-    ktr  = 1;
-    /* sgp4fix for kepler iteration */
-    /* the following iteration needs better limits on corrections */
-    while (( fabs(tem5) >= 1.0e-12) && (ktr <= 10))
+    else
     {
-        sineo1 = sin(eo1);
-        coseo1 = cos(eo1);
-        tem5   = 1.0 - coseo1 * axnl - sineo1 * aynl;
-        tem5   = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
-        if (fabs(tem5) >= 0.95)
-        {
-            tem5 = tem5 > 0.0 ? 0.95 : -0.95;
-        }
-        eo1    = eo1 + tem5;
-        ktr = ktr + 1;
+        ok = sgp4_propagate(consts, satrec, tsince, r, v);
     }
 
-    /* Short period preliminary quantities */
-    ecose = axnl*coseo1 + aynl*sineo1;
-    esine = axnl*sineo1 - aynl*coseo1;
-    el2   = axnl*axnl + aynl*aynl;
-    pl    = am*(1.0-el2);
-    if (pl < 0.0)
+    out->x[i] = r[0];
+    out->y[i] = r[1];
+    out->z[i] = r[2];
+    if (out->vx != NULL)
     {
-        satrec->error = 4;
-        /* sgp4fix add return */
-        return false;
+        out->vx[i] = v[0];
+        out->vy[i] = v[1];
+        out->vz[i] = v[2];
     }
-    else
+    if (out->error != NULL)
     {
-        rl     = am * (1.0 - ecose);
-        rdotl  = sqrt(am) * esine/rl;
-        rvdotl = sqrt(pl) / rl;
-        betal  = sqrt(1.0 - el2);
-        temp   = esine / (1.0 + betal);
-        sinu   = am / rl * (sineo1 - aynl - axnl * temp);
-        cosu   = am / rl * (coseo1 - axnl + aynl * temp);
-        su     = atan2(sinu, cosu);
-        sin2u  = (cosu + cosu) * sinu;
-        cos2u  = 1.0 - 2.0 * sinu * sinu;
-        temp   = 1.0 / pl;
-        temp1  = 0.5 * j2 * temp;
-        temp2  = temp1 * temp;
-
-        /* Update for short period periodics */
-        if (satrec->method == 'd')
-        {
-            cosisq = cosip * cosip;
-            satrec->con41  = 3.0 * cosisq - 1.0;
-            satrec->x1mth2 = 1.0 - cosisq;
-            satrec->x7thm1 = 7.0 * cosisq - 1.0;
-        }
-        mrt   = rl * (1.0 - 1.5 * temp2 * betal * satrec->con41) + 0.5 * temp1 * satrec->x1mth2 * cos2u;
-        su    = su - 0.25 * temp2 * satrec->x7thm1 * sin2u;
-        xnode = nodep + 1.5 * temp2 * cosip * sin2u;
-        xinc  = xincp + 1.5 * temp2 * cosip * sinip * cos2u;
-        mvt   = rdotl - nm * temp1 * satrec->x1mth2 * sin2u / xke;
-        rvdot = rvdotl + nm * temp1 * (satrec->x1mth2 * cos2u + 1.5 * satrec->con41) / xke;
-
-        /* Orientation vectors */
-        sinsu =  sin(su);
-        cossu =  cos(su);
-        snod  =  sin(xnode);
-        cnod  =  cos(xnode);
-        sini  =  sin(xinc);
-        cosi  =  cos(xinc);
-        xmx   = -snod * cosi;
-        xmy   =  cnod * cosi;
-        ux    =  xmx * sinsu + cnod * cossu;
-        uy    =  xmy * sinsu + snod * cossu;
-        uz    =  sini * sinsu;
-        vx    =  xmx * cossu - cnod * sinsu;
-        vy    =  xmy * cossu - snod * sinsu;
-        vz    =  sini * cossu;
-
-        /* Position and velocity (in km and km/sec) */
-        r[0] = (mrt * ux)* radiusearthkm;
-        r[1] = (mrt * uy)* radiusearthkm;
-        r[2] = (mrt * uz)* radiusearthkm;
-        v[0] = (mvt * ux + rvdot * vx) * vkmpersec;
-        v[1] = (mvt * uy + rvdot * vy) * vkmpersec;
-        v[2] = (mvt * uz + rvdot * vz) * vkmpersec;
-    } /* if pl > 0 */
-
-    /* sgp4fix for decaying satellites */
-    if (mrt < 1.0)
+        out->error[i] = satrec->error;
+    }
+
+    return ok;
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure sgp4_batch
+*
+*  this procedure propagates an array of initialised records to one julian
+*    date. the results are written to structure-of-arrays buffers so they can
+*    be consumed directly by vectorised stages downstream.
+*
+*  inputs        :
+*    whichconst  - which set of constants to use  wgs72old, wgs72, wgs84
+*    satrecs     - records initialised by sgp4init or twoline2rv
+*    n           - number of records
+*    jd          - julian date to propagate to     days from 4713 bc
+*
+*  outputs       :
+*    out         - positions (km), velocities (km/s) and error codes.
+*                  records that fail with error 1 to 4 get nan positions.
+*    return      - number of records propagated without error
+*
+*  coupling      :
+*    sgp4_batch_tsince
+  --------------------------------------------------------------------------- */
+
+size_t sgp4_batch(gravconsttype whichconst, elsetrec satrecs[], size_t n, double jd, sgp4_soa_t *out)
+{
+    sgp4consts consts;
+    size_t i, nok = 0;
+
+    sgp4_getconsts(whichconst, &consts);
+
+    for(i = 0; i < n; i++)
     {
-        satrec->error = 6;
-        return false;
+        nok += sgp4_store(whichconst, &consts, &satrecs[i], (jd - satrecs[i].jdsatepoch) * 1440.0, out, i);
     }
 
-    return true;
+    return nok;
+}
+
+/* -----------------------------------------------------------------------------
+*
+*                           procedure sgp4_batch_tsince
+*
+*  same as sgp4_batch, but with one time since epoch (minutes) per record.
+  --------------------------------------------------------------------------- */
+
+size_t sgp4_batch_tsince(gravconsttype whichconst, elsetrec satrecs[], size_t n, const double tsince[], sgp4_soa_t *out)
+{
+    sgp4consts consts;
+    size_t i, nok = 0;
+
+    sgp4_getconsts(whichconst, &consts);
+
+    for(i = 0; i < n; i++)
+    {
+        nok += sgp4_store(whichconst, &consts, &satrecs[i], tsince[i], out, i);
+    }
+
+    return nok;
 }
 
 /* -----------------------------------------------------------------------------
@@ -2120,4 +2287,21 @@ void getgravconst(gravconsttype whichconst, double *tumin, double *mu, double *r
     }
 }
 
+/* -----------------------------------------------------------------------------
+*
+*                           procedure sgp4_getconsts
+*
+*  this procedure resolves the constants the propagator needs for one
+*    gravity model, including the velocity conversion factor.
+  --------------------------------------------------------------------------- */
+
+static void sgp4_getconsts(gravconsttype whichconst, sgp4consts *consts)
+{
+    double tumin, mu, j3, j4;
+
+    getgravconst(whichconst, &tumin, &mu, &consts->radiusearthkm, &consts->xke,
+                 &consts->j2, &j3, &j4, &consts->j3oj2);
+    consts->vkmpersec = consts->radiusearthkm * consts->xke / 60.0;
+}
+
 /** \} End of sgp4unit group */
@@ -0,0 +1,398 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief sgp4 equations shared by the propagators of sgp4unit.c and sgp4compact.c.
+ *
+ * Holds sgp4_kernel, the body of sgp4() (see sgp4unit.c for its history and references),
+ * so that every scalar propagator runs the same code. The record is only read through the
+ * fields sgp4init sets, and the outputs go to a sgp4_ctx_t.
+ *
+ * This file is a template: it has no include guard and is included once per record layout,
+ * which must define before including it:
+ *
+ * - SGP4_KERNEL_FN: name of the generated function.
+ * - SGP4_KERNEL_REC: record type, with the near earth fields of elsetrec under the same
+ *   names (and the deep space ones too when SGP4_KERNEL_DEEP is 1).
+ * - SGP4_KERNEL_CONSTS: type holding radiusearthkm, xke, j2 and vkmpersec (and j3oj2 when
+ *   SGP4_KERNEL_DEEP is 1).
+ * - SGP4_KERNEL_DEEP: 1 to include the deep space path, which needs dpper and dspace, or 0
+ *   for near earth records only.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4unit
+ * \{
+ */
+
+#ifndef SGP4_KERNEL_KINDS_
+#define SGP4_KERNEL_KINDS_
+
+/* ----------- kinds of record, one specialised propagator each ---------- */
+enum
+{
+    sgp4_near_full,     /* near earth, isimp = 0 */
+    sgp4_near_simple,   /* near earth, isimp = 1 */
+    sgp4_deep_afspc,    /* deep space, opsmode 'a' */
+    sgp4_deep_improved, /* deep space, opsmode 'i' */
+    sgp4_kinds
+};
+
+#endif /* SGP4_KERNEL_KINDS_ */
+
+/*-----------------------------------------------------------------------------
+*
+*                             procedure sgp4_kernel
+*
+*  this procedure holds the sgp4 equations. it never writes to the record:
+*    the outputs that sgp4 used to keep in elsetrec go to the context. the
+*    kind of record and the opsmode are arguments, so callers passing
+*    constants get a propagator without the method and isimp branches.
+*
+*  inputs        :
+*    consts      - constants filled by sgp4_getconsts
+*    satrec      - initialised structure from sgp4init() call.
+*    ctx         - atime, xli, xni of the resonance integrator
+*    tsince      - time since epoch (minutes)
+*    kind        - sgp4_near_full, sgp4_near_simple or one of the deep kinds
+*    opsmode     - mode of operation afspc or improved 'a', 'i'
+*
+*  outputs       :
+*    ctx         - t, error, integrator state and scratch
+*    r           - position vector                     km
+*    v           - velocity                            km/sec
+*
+*  coupling      :
+*    dpper
+*    dspace
+  ----------------------------------------------------------------------------*/
+
+static bool SGP4_KERNEL_FN(const SGP4_KERNEL_CONSTS *consts, const SGP4_KERNEL_REC *satrec, sgp4_ctx_t *ctx,
+                           double tsince, double r[3], double v[3], int kind, char opsmode)
+{
+    double am,      axnl,   aynl,   betal,  cosim , cnod,
+           cos2u,   coseo1, cosi,   cosip,  cossu,  cosu,
+           delm,    delomg, em,     emsq,   ecose,  el2,    eo1 ,
+           ep,      esine,  argpm,  argpp,  argpdf, pl,     mrt = 0.0,
+           mvt,     rdotl,  rl,     rvdot,  rvdotl, sinim,
+           sin2u,   sineo1, sini,   sinip,  sinsu,  sinu,
+           snod,    su,     t2,     t3,     t4,     tem5,   temp,
+           temp1,   temp2,  tempa,  tempe,  templ,  u,      ux,
+           uy,      uz,     vx,     vy,     vz,     inclm,  mm,
+           nm,      nodem,  xinc,   xincp,  xl,     xlm,    mp,
+           xmdf,    xmx,    xmy,    nodedf, xnode,  nodep,
+           twopi,   x2o3,   j2,     xke,    radiusearthkm,
+           vkmpersec, delmtemp;
+    int ktr;
+#if SGP4_KERNEL_DEEP
+    double cosisq, tc, dndt, j3oj2;
+
+    /* Set mathematical constants */
+    // sgp4fix divisor for divide by zero check on inclination
+    // the old check used 1.0 + cos(pi-1.0e-9), but then compared it to
+    // 1.5 e-12, so the threshold was changed to 1.5e-12 for consistency
+    const double temp4 =   1.5e-12;
+    j3oj2         = consts->j3oj2;
+#else
+    (void)opsmode;
+#endif
+    twopi = 2.0 * pi;
+    x2o3  = 2.0 / 3.0;
+    radiusearthkm = consts->radiusearthkm;
+    xke           = consts->xke;
+    j2            = consts->j2;
+    vkmpersec     = consts->vkmpersec;
+
+    /* Clear sgp4 error flag */
+    ctx->t       = tsince;
+    ctx->error   = 0;
+
+    /* Scratch values, overwritten below for deep space records */
+    ctx->aycof   = satrec->aycof;
+    ctx->xlcof   = satrec->xlcof;
+    ctx->con41   = satrec->con41;
+    ctx->x1mth2  = satrec->x1mth2;
+    ctx->x7thm1  = satrec->x7thm1;
+
+    /* Update for secular gravity and atmospheric drag */
+    xmdf    = satrec->mo + satrec->mdot * ctx->t;
+    argpdf  = satrec->argpo + satrec->argpdot * ctx->t;
+    nodedf  = satrec->nodeo + satrec->nodedot * ctx->t;
+    argpm   = argpdf;
+    mm      = xmdf;
+    t2      = ctx->t * ctx->t;
+    nodem   = nodedf + satrec->nodecf * t2;
+    tempa   = 1.0 - satrec->cc1 * ctx->t;
+    tempe   = satrec->bstar * satrec->cc4 * ctx->t;
+    templ   = satrec->t2cof * t2;
+
+    if (kind == sgp4_near_full)
+    {
+        delomg = satrec->omgcof * ctx->t;
+        /* sgp4fix use mutliply for speed instead of pow */
+        delmtemp =  1.0 + satrec->eta * cos(xmdf);
+        delm   = satrec->xmcof *
+                 (delmtemp * delmtemp * delmtemp -
+                 satrec->delmo);
+        temp   = delomg + delm;
+        mm     = xmdf + temp;
+        argpm  = argpdf - temp;
+        t3     = t2 * ctx->t;
+        t4     = t3 * ctx->t;
+        tempa  = tempa - satrec->d2 * t2 - satrec->d3 * t3 -
+                         satrec->d4 * t4;
+        tempe  = tempe + satrec->bstar * satrec->cc5 * (sin(mm) -
+                         satrec->sinmao);
+        templ  = templ + satrec->t3cof * t3 + t4 * (satrec->t4cof +
+                         ctx->t * satrec->t5cof);
+    }
+
+    nm    = satrec->no;
+    em    = satrec->ecco;
+    inclm = satrec->inclo;
+#if SGP4_KERNEL_DEEP
+    if (kind >= sgp4_deep_afspc)
+    {
+        tc = ctx->t;
+        dspace(satrec->irez,
+               satrec->d2201, satrec->d2211, satrec->d3210,
+               satrec->d3222, satrec->d4410, satrec->d4422,
+               satrec->d5220, satrec->d5232, satrec->d5421,
+               satrec->d5433, satrec->dedt,  satrec->del1,
+               satrec->del2,  satrec->del3,  satrec->didt,
+               satrec->dmdt,  satrec->dnodt, satrec->domdt,
+               satrec->argpo, satrec->argpdot, ctx->t, tc,
+               satrec->gsto, satrec->xfact, satrec->xlamo,
+               satrec->no, ctx->atime,
+               em, argpm, inclm, ctx->xli, mm, ctx->xni,
+               nodem, dndt, nm);
+    }
+#endif
+
+    if (nm <= 0.0)
+    {
+        ctx->error = 2;
+        /* sgp4fix add return */
+        return false;
+    }
+    am = pow((xke / nm), x2o3) * tempa * tempa;
+    nm = xke / pow(am, 1.5);
+    em = em - tempe;
+
+    /* fix tolerance for error recognition */
+    /* sgp4fix am is fixed from the previous nm check */
+    if ((em >= 1.0) || (em < -0.001)/* || (am < 0.95)*/ )
+    {
+        ctx->error = 1;
+        // sgp4fix to return if there is an error in eccentricity
+        return false;
+    }
+    /* sgp4fix fix tolerance to avoid a divide by zero */
+    if (em < 1.0e-6)
+    {
+        em  = 1.0e-6;
+    }
+    mm     = mm + satrec->no * templ;
+    xlm    = mm + argpm + nodem;
+    emsq   = em * em;
+    temp   = 1.0 - emsq;
+
+    nodem  = floatmod(nodem, twopi);
+    argpm  = floatmod(argpm, twopi);
+    xlm    = floatmod(xlm, twopi);
+    mm     = floatmod(xlm - argpm - nodem, twopi);
+
+    /* Compute extra mean quantities */
+    sinim = sin(inclm);
+    cosim = cos(inclm);
+
+    /* Add lunar-solar periodics */
+    ep     = em;
+    xincp  = inclm;
+    argpp  = argpm;
+    nodep  = nodem;
+    mp     = mm;
+    sinip  = sinim;
+    cosip  = cosim;
+#if SGP4_KERNEL_DEEP
+    if (kind >= sgp4_deep_afspc)
+    {
+        dpper(satrec->e3,   satrec->ee2,  satrec->peo,
+              satrec->pgho, satrec->pho,  satrec->pinco,
+              satrec->plo,  satrec->se2,  satrec->se3,
+              satrec->sgh2, satrec->sgh3, satrec->sgh4,
+              satrec->sh2,  satrec->sh3,  satrec->si2,
+              satrec->si3,  satrec->sl2,  satrec->sl3,
+              satrec->sl4,  ctx->t,    satrec->xgh2,
+              satrec->xgh3, satrec->xgh4, satrec->xh2,
+              satrec->xh3,  satrec->xi2,  satrec->xi3,
+              satrec->xl2,  satrec->xl3,  satrec->xl4,
+              satrec->zmol, satrec->zmos, satrec->inclo,
+              'n', ep, xincp, nodep, argpp, mp, opsmode);
+        if (xincp < 0.0)
+        {
+            xincp  = -xincp;
+            nodep = nodep + pi;
+            argpp  = argpp - pi;
+        }
+        if ((ep < 0.0 ) || ( ep > 1.0))
+        {
+            ctx->error = 3;
+            /* sgp4fix add return */
+            return false;
+        }
+    }
+#endif
+
+    /* Long period periodics */
+#if SGP4_KERNEL_DEEP
+    if (kind >= sgp4_deep_afspc)
+    {
+        sinip =  sin(xincp);
+        cosip =  cos(xincp);
+        ctx->aycof = -0.5*j3oj2*sinip;
+        /* sgp4fix for divide by zero for xincp = 180 deg */
+        if (fabs(cosip+1.0) > 1.5e-12)
+        {
+            ctx->xlcof = -0.25 * j3oj2 * sinip * (3.0 + 5.0 * cosip) / (1.0 + cosip);
+        }
+        else
+        {
+            ctx->xlcof = -0.25 * j3oj2 * sinip * (3.0 + 5.0 * cosip) / temp4;
+        }
+    }
+#endif
+    axnl = ep * cos(argpp);
+    temp = 1.0 / (am * (1.0 - ep * ep));
+    aynl = ep* sin(argpp) + temp * ctx->aycof;
+    xl   = mp + argpp + nodep + temp * ctx->xlcof * axnl;
+
+    /* Solve kepler's equation */
+    u    = floatmod(xl - nodep, twopi);
+    eo1  = u;
+    tem5 = 9999.9;
+    ktr  = 1;
+    /* sgp4fix for kepler iteration */
+    /* the following iteration needs better limits on corrections */
+    while (( fabs(tem5) >= 1.0e-12) && (ktr <= 10))
+    {
+        sineo1 = sin(eo1);
+        coseo1 = cos(eo1);
+        tem5   = 1.0 - coseo1 * axnl - sineo1 * aynl;
+        tem5   = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+        if (fabs(tem5) >= 0.95)
+        {
+            tem5 = tem5 > 0.0 ? 0.95 : -0.95;
+        }
+        eo1    = eo1 + tem5;
+        ktr = ktr + 1;
+    }
+
+    /* Short period preliminary quantities */
+    ecose = axnl*coseo1 + aynl*sineo1;
+    esine = axnl*sineo1 - aynl*coseo1;
+    el2   = axnl*axnl + aynl*aynl;
+    pl    = am*(1.0-el2);
+    if (pl < 0.0)
+    {
+        ctx->error = 4;
+        /* sgp4fix add return */
+        return false;
+    }
+    else
+    {
+        rl     = am * (1.0 - ecose);
+        rdotl  = sqrt(am) * esine/rl;
+        rvdotl = sqrt(pl) / rl;
+        betal  = sqrt(1.0 - el2);
+        temp   = esine / (1.0 + betal);
+        sinu   = am / rl * (sineo1 - aynl - axnl * temp);
+        cosu   = am / rl * (coseo1 - axnl + aynl * temp);
+        su     = atan2(sinu, cosu);
+        sin2u  = (cosu + cosu) * sinu;
+        cos2u  = 1.0 - 2.0 * sinu * sinu;
+        temp   = 1.0 / pl;
+        temp1  = 0.5 * j2 * temp;
+        temp2  = temp1 * temp;
+
+        /* Update for short period periodics */
+#if SGP4_KERNEL_DEEP
+        if (kind >= sgp4_deep_afspc)
+        {
+            cosisq = cosip * cosip;
+            ctx->con41  = 3.0 * cosisq - 1.0;
+            ctx->x1mth2 = 1.0 - cosisq;
+            ctx->x7thm1 = 7.0 * cosisq - 1.0;
+        }
+#endif
+        mrt   = rl * (1.0 - 1.5 * temp2 * betal * ctx->con41) + 0.5 * temp1 * ctx->x1mth2 * cos2u;
+        su    = su - 0.25 * temp2 * ctx->x7thm1 * sin2u;
+        xnode = nodep + 1.5 * temp2 * cosip * sin2u;
+        xinc  = xincp + 1.5 * temp2 * cosip * sinip * cos2u;
+        mvt   = rdotl - nm * temp1 * ctx->x1mth2 * sin2u / xke;
+        rvdot = rvdotl + nm * temp1 * (ctx->x1mth2 * cos2u + 1.5 * ctx->con41) / xke;
+
+        /* Orientation vectors */
+        sinsu =  sin(su);
+        cossu =  cos(su);
+        snod  =  sin(xnode);
+        cnod  =  cos(xnode);
+        sini  =  sin(xinc);
+        cosi  =  cos(xinc);
+        xmx   = -snod * cosi;
+        xmy   =  cnod * cosi;
+        ux    =  xmx * sinsu + cnod * cossu;
+        uy    =  xmy * sinsu + snod * cossu;
+        uz    =  sini * sinsu;
+        vx    =  xmx * cossu - cnod * sinsu;
+        vy    =  xmy * cossu - snod * sinsu;
+        vz    =  sini * cossu;
+
+        /* Position and velocity (in km and km/sec) */
+        r[0] = (mrt * ux)* radiusearthkm;
+        r[1] = (mrt * uy)* radiusearthkm;
+        r[2] = (mrt * uz)* radiusearthkm;
+        v[0] = (mvt * ux + rvdot * vx) * vkmpersec;
+        v[1] = (mvt * uy + rvdot * vy) * vkmpersec;
+        v[2] = (mvt * uz + rvdot * vz) * vkmpersec;
+    } /* if pl > 0 */
+
+    /* sgp4fix for decaying satellites */
+    if (mrt < 1.0)
+    {
+        ctx->error = 6;
+        return false;
+    }
+
+    return true;
+}
+
+/** \} End of sgp4unit group */
@@ -0,0 +1,188 @@
+/*
+ * Released under MIT License
+ *
+ * Copyright (c) 2021 Hopperpop.
+ *
+ * Copyright The libsgp4 Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * \brief Vector math helpers for the SIMD kernels.
+ *
+ * Lane-wise floor, floatmod, sincos and atan2 written with GCC vector extensions. The
+ * polynomials and range reductions are the ones of the Cephes library, so each lane agrees
+ * with libm to within a few ulp for the argument ranges seen by the propagator (|x| < 1e8).
+ *
+ * This file is a template: it has no include guard and is included once per instruction set
+ * by a kernel file, which must define before including it:
+ *
+ * - VD: vector of doubles type.
+ * - VL: vector of 64-bit integers type with the same number of lanes.
+ * - VFN(name): mangles a function name for the instruction set.
+ * - VATTR: storage class and attributes of every generated function.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0.3
+ *
+ * \date 2026/10/16
+ *
+ * \addtogroup sgp4simd
+ * \{
+ */
+
+#ifndef VMATH_CONSTANTS_
+#define VMATH_CONSTANTS_
+
+#define VMATH_MAGIC     6755399441055744.0          /* 1.5 * 2^52, rounds a double to an integer */
+#define VMATH_SIGN      (-0x7fffffffffffffffLL - 1)    /* sign bit of a double */
+#define VMATH_ABS       0x7fffffffffffffffLL
+#define VMATH_FOPI      1.27323954473516268615      /* 4 / pi */
+#define VMATH_DP1       7.85398125648498535156e-1   /* pi / 4 split in three parts */
+#define VMATH_DP2       3.77489470793079817668e-8
+#define VMATH_DP3       2.69515142907905952645e-15
+#define VMATH_T3P8      2.41421356237309504880      /* tan(3 * pi / 8) */
+#define VMATH_MOREBITS  6.123233995736765886130e-17 /* pi / 2 = PIO2 + MOREBITS */
+#define VMATH_PIO2      1.57079632679489661923
+#define VMATH_PIO4      7.85398163397448309616e-1
+
+#endif /* VMATH_CONSTANTS_ */
+
+/* Broadcast a scalar to every lane */
+VATTR VD VFN(vsplat)(double a)
+{
+    VD v = {0};
+
+    return v + a;
+}
+
+/* Lane-wise select: m ? a : b, where every lane of m is all ones or all zeros */
+VATTR VD VFN(vsel)(VL m, VD a, VD b)
+{
+    return (VD)(((VL)a & m) | ((VL)b & ~m));
+}
+
+VATTR VD VFN(vabs)(VD x)
+{
+    return (VD)((VL)x & VMATH_ABS);
+}
+
+/* Lane-wise floor, valid for |x| < 2^51 */
+VATTR VD VFN(vfloor)(VD x)
+{
+    VD r = (x + VMATH_MAGIC) - VMATH_MAGIC;
+
+    return r - VFN(vsel)(r > x, VFN(vsplat)(1.0), VFN(vsplat)(0.0));
+}
+
+/* Same definition as floatmod(): a - b * floor(a / b) */
+VATTR VD VFN(vfloatmod)(VD a, double b)
+{
+    return a - b * VFN(vfloor)(a / b);
+}
+
+/* Lane-wise sine and cosine (Cephes sin.c) */
+VATTR void VFN(vsincos)(VD x, VD *s, VD *c)
+{
+    VD ax, y, z, zz, ps, pc, sn, cs;
+    VL j, swap, negs, negc;
+
+    ax = VFN(vabs)(x);
+
+    /* Octant of the argument, rounded to an even number */
+    y  = VFN(vfloor)(ax * VMATH_FOPI);
+    j  = (VL)(y + VMATH_MAGIC) & 7;
+    y  = y + VFN(vsel)((j & 1) != 0, VFN(vsplat)(1.0), VFN(vsplat)(0.0));
+    j  = (j + (j & 1)) & 7;
+
+    /* Extended precision modular arithmetic */
+    z  = ((ax - y * VMATH_DP1) - y * VMATH_DP2) - y * VMATH_DP3;
+    zz = z * z;
+
+    ps = VFN(vsplat)(1.58962301576546568060e-10);
+    ps = ps * zz - 2.50507477628578072866e-8;
+    ps = ps * zz + 2.75573136213857245213e-6;
+    ps = ps * zz - 1.98412698295895385996e-4;
+    ps = ps * zz + 8.33333333332211858878e-3;
+    ps = ps * zz - 1.66666666666666307295e-1;
+    ps = z + z * zz * ps;
+
+    pc = VFN(vsplat)(-1.13585365213876817300e-11);
+    pc = pc * zz + 2.08757008419747316778e-9;
+    pc = pc * zz - 2.75573141792967388112e-7;
+    pc = pc * zz + 2.48015872888517045348e-5;
+    pc = pc * zz - 1.38888888888730564116e-3;
+    pc = pc * zz + 4.16666666666665929218e-2;
+    pc = 1.0 - 0.5 * zz + zz * zz * pc;
+
+    /* Quadrant 0: (s, c), 1: (c, -s), 2: (-s, -c), 3: (-c, s) */
+    swap = (j == 2) | (j == 6);
+    negs = (j == 4) | (j == 6);
+    negc = (j == 2) | (j == 4);
+
+    sn = VFN(vsel)(swap, pc, ps);
+    cs = VFN(vsel)(swap, ps, pc);
+    sn = (VD)((VL)sn ^ (negs & VMATH_SIGN) ^ ((VL)x & VMATH_SIGN));
+    cs = (VD)((VL)cs ^ (negc & VMATH_SIGN));
+
+    *s = sn;
+    *c = cs;
+}
+
+/* Lane-wise arc tangent of y / x in the range -pi to pi (Cephes atan.c) */
+VATTR VD VFN(vatan2)(VD y, VD x)
+{
+    VD ax, ay, t, z, p, q, r, y0, extra;
+    VL big, mid;
+
+    ax = VFN(vabs)(x);
+    ay = VFN(vabs)(y);
+    t  = ay / ax;
+
+    /* Range reduction */
+    big   = t > VMATH_T3P8;
+    mid   = (t > 0.66) & ~big;
+    y0    = VFN(vsel)(big, VFN(vsplat)(VMATH_PIO2), VFN(vsel)(mid, VFN(vsplat)(VMATH_PIO4), VFN(vsplat)(0.0)));
+    extra = VFN(vsel)(big, VFN(vsplat)(VMATH_MOREBITS), VFN(vsel)(mid, VFN(vsplat)(0.5 * VMATH_MOREBITS), VFN(vsplat)(0.0)));
+    t     = VFN(vsel)(big, -1.0 / t, VFN(vsel)(mid, (t - 1.0) / (t + 1.0), t));
+
+    z = t * t;
+    p = VFN(vsplat)(-8.750608600031904122785e-1);
+    p = p * z - 1.615753718733365076637e1;
+    p = p * z - 7.500855792314704667340e1;
+    p = p * z - 1.228866684490136173410e2;
+    p = p * z - 6.485021904942025371773e1;
+    q = z + 2.485846490142306297962e1;
+    q = q * z + 1.650270098316988542046e2;
+    q = q * z + 4.328810604912902668951e2;
+    q = q * z + 4.853903996359136964868e2;
+    q = q * z + 1.945506571482613964425e2;
+    r = y0 + (t * z * p / q + t + extra);
+
+    /* Quadrant of (x, y) */
+    r = VFN(vsel)(x < 0.0, 2.0 * VMATH_PIO2 - r, r);
+    r = VFN(vsel)((ax == 0.0) & (ay == 0.0), VFN(vsplat)(0.0), r);
+
+    return (VD)((VL)r ^ ((VL)y & VMATH_SIGN));
+}
+
+/** \} End of sgp4simd group */